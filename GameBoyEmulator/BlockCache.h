@@ -0,0 +1,121 @@
+#pragma once
+#include "Memory.h"
+#include "OpcodeInfo.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+using namespace std;
+
+class CPU;
+struct RegisterFile;
+//every opcode is executed by one of these, looked up directly by the opcode byte
+typedef void (CPU::*OpHandler)(uint8_t opCode);
+//a block translated to host code by the Recompiler, it runs on the CPU's registers
+typedef void (*NativeBlock)(RegisterFile* registers);
+
+//one instruction, decoded once and replayed without touching memory
+struct MicroOp
+{
+	OpHandler handler;
+	uint16_t address;
+	//CB opcode for prefixed instructions
+	uint8_t opCode;
+	uint8_t operands[2];
+	uint8_t length;
+	uint8_t cycles;
+	uint8_t properties;
+	bool prefixed;
+};
+
+//straight line run of instructions, ends after the first one that can branch
+struct DecodedBlock
+{
+	uint16_t startAddress;
+	int bank;
+	//a block never spans more than two pages
+	uint8_t firstPage, lastPage;
+	uint32_t firstPageVersion, lastPageVersion;
+	int cycles;
+	vector<MicroOp> ops;
+	//jumps back to its own start and only polls memory, see CPU::isIdleLoop
+	bool idleLoop;
+	//Recompiler state
+	int executionCount;
+	NativeBlock nativeCode;
+	bool nativeRejected;
+};
+
+class BlockCache
+{
+	//Attributes
+public:
+	static const int MAX_BLOCK_OPS = 32;
+private:
+	Memory* memory;
+	unordered_map<uint32_t, DecodedBlock> blocks;
+	//Methods
+public:
+	BlockCache(Memory* memPtr);
+	DecodedBlock* lookup(uint16_t address);
+	DecodedBlock* create(uint16_t address);
+	bool isValid(const DecodedBlock &block);
+	void clear();
+	void dropNativeCode();
+private:
+	uint32_t makeKey(uint16_t address);
+};
+
+BlockCache::BlockCache(Memory* memPtr)
+{
+	this->memory = memPtr;
+}
+//keyed by bank:address so switching banks selects a different block rather than flushing
+uint32_t BlockCache::makeKey(uint16_t address)
+{
+	return ((uint32_t)this->memory->getBankAt(address) << 16) | address;
+}
+//block for the address, or nullptr if it was never decoded or memory under it has changed
+DecodedBlock* BlockCache::lookup(uint16_t address)
+{
+	unordered_map<uint32_t, DecodedBlock>::iterator it = this->blocks.find(this->makeKey(address));
+	if (it == this->blocks.end() || !this->isValid(it->second))
+		return nullptr;
+	return &it->second;
+}
+//empty block for the address, replacing any stale one. The caller fills in the ops
+DecodedBlock* BlockCache::create(uint16_t address)
+{
+	DecodedBlock &block = this->blocks[this->makeKey(address)];
+	block.startAddress = address;
+	block.bank = this->memory->getBankAt(address);
+	block.firstPage = address >> 8;
+	block.lastPage = address >> 8;
+	block.firstPageVersion = this->memory->getPageVersion(block.firstPage);
+	block.lastPageVersion = block.firstPageVersion;
+	block.cycles = 0;
+	block.ops.clear();
+	block.idleLoop = false;
+	block.executionCount = 0;
+	block.nativeCode = nullptr;
+	block.nativeRejected = false;
+	return &block;
+}
+bool BlockCache::isValid(const DecodedBlock &block)
+{
+	return this->memory->getPageVersion(block.firstPage) == block.firstPageVersion
+		&& this->memory->getPageVersion(block.lastPage) == block.lastPageVersion
+		&& this->memory->getBankAt(block.startAddress) == block.bank;
+}
+void BlockCache::clear()
+{
+	this->blocks.clear();
+}
+//forget every translation, used when the Recompiler reuses its code arena
+void BlockCache::dropNativeCode()
+{
+	for (unordered_map<uint32_t, DecodedBlock>::iterator it = this->blocks.begin(); it != this->blocks.end(); it++)
+	{
+		it->second.nativeCode = nullptr;
+		it->second.executionCount = 0;
+	}
+}
@@ -1,7027 +1,1407 @@
 #pragma once
 #include "Memory.h"
 #include "Instruction.h"
-#include "Register.h"
-#include <iostream>
+#include "RegisterFile.h"
+#include "OpcodeInfo.h"
+#include "BlockCache.h"
+#include "Recompiler.h"
+#include "Trace.h"
+#include "PPU.h"
+#include "Scheduler.h"
 #include <cstdint>
 using namespace std;
 
-enum CpuState{ RUNNING, INTERRUPT, STOP, HALT };
+//Define THREADED_DISPATCH to run stepCPU on the computed goto engine in runThreaded.
+//It needs the GCC/Clang labels as values extension, other compilers keep the table loop.
+//The threaded engine runs in place of the block engine, so nothing would run the recompiled blocks.
+#if defined(THREADED_DISPATCH) && defined(DYNAMIC_RECOMPILER)
+#error THREADED_DISPATCH and DYNAMIC_RECOMPILER cannot be used together
+#endif
+#if defined(THREADED_DISPATCH) && (defined(__GNUC__) || defined(__clang__))
+#define THREADED_DISPATCH_ENABLED
+#endif
+
+//Define INSTRUCTION_TRACE to record every interpreted instruction to trace.bin.
+//Without it the trace policy is NullTrace and none of the tracing code is compiled.
+#ifdef INSTRUCTION_TRACE
+typedef RingBufferTrace TracePolicy;
+#else
+typedef NullTrace TracePolicy;
+#endif
+
+//Define LAZY_FLAGS to record the last flag producing operation and only work out F when it is read.
 
 class CPU
 {
 	//Attributes
 private:
-	int CLOCK;
 	Memory* memory;
-	Register A, F, B, C, D, E, H, L;
-	uint16_t programCounter = 0, stackPointer;
-	CpuState cpuState = RUNNING;
-	bool interruptsEnabled = true;
+	//lives in the machine state arena owned by Memory
+	RegisterFile &registers;
+	Scheduler scheduler;
+	BlockCache blockCache;
+	//operand bytes of the instruction being executed, consumed by fetchByte
+	const uint8_t* operandPointer = nullptr;
+	uint8_t operandBuffer[2] = {};
+	TracePolicy trace;
+#ifdef DYNAMIC_RECOMPILER_ENABLED
+	Recompiler recompiler;
+	//block the native code currently running belongs to
+	DecodedBlock* currentBlock = nullptr;
+#endif
+	//register and value pairs the DMG boot ROM leaves behind
+	static const uint16_t postBootIo[31][2];
+	static const OpHandler baseTable[256];
+	static const OpHandler cbTable[256];
 public:
 	//Methods
-	bool executeInstruction(Instruction instructionToExecute, uint16_t &PC, uint8_t nextOpCode, uint8_t* memory, int &cyclesLeft);
-private:
-	bool executeCBPrefixInstruction(Instruction instructionToExecute, uint16_t &PC, uint8_t* memory, int &cyclesLeft);
+	bool executeInstruction(Instruction instructionToExecute);
+	void executeBlock(uint64_t deadline);
 public:
-	CPU(Memory* memPtr, int clock);
+	CPU(Memory* memPtr);
 	void stepCPU();
+	void skipBootRom();
+	uint64_t runCycles(uint64_t cycles);
+	uint64_t runUntil(uint64_t cycle);
+	bool runFrame();
+	uint64_t getCycleCount();
+	Scheduler* getScheduler();
+	size_t getStateSize();
+	void saveState(void* buffer);
+	void loadState(const void* buffer);
+#ifdef THREADED_DISPATCH_ENABLED
+	void runThreaded(uint64_t deadline);
+#endif
 	void setCpuState(CpuState newState);
 	CpuState getCpuState();
 	bool getInteruptStatus();
 	void setInteruptStatus(bool newIntStatus);
+private:
+	DecodedBlock* decodeBlock(uint16_t address);
+	bool isIdleLoop(const DecodedBlock* block);
+	bool getPolledAddress(const MicroOp &op, uint16_t &address);
+	void skipIdleLoop(DecodedBlock* block, uint64_t deadline);
+	bool executeMicroOp(const MicroOp &op, DecodedBlock* block);
+	void serviceInterrupts();
+	static uint8_t readInterruptRegister(void* component, uint16_t address);
+	static void writeInterruptRegister(void* component, uint16_t address, uint8_t value);
+	void traceFetched(uint16_t address, uint8_t opCode);
+#ifdef DYNAMIC_RECOMPILER_ENABLED
+	void compileBlock(DecodedBlock* block);
+	GuestLayout getGuestLayout();
+	static bool nativeFallback(CPU* cpu, const MicroOp* op);
+#endif
+	//operand access
+	void loadOperands(uint8_t opCode);
+	uint8_t fetchByte();
+	uint16_t fetchWord();
+	template<Operand R> uint8_t readOperand();
+	template<Operand R> void writeOperand(uint8_t value);
+	uint16_t readPair(uint8_t index);
+	void writePair(uint8_t index, uint16_t value);
+	void pushWord(uint16_t value);
+	uint16_t popWord();
+	bool getFlag(uint8_t flag);
+	void setFlags(bool zero, bool subtract, bool halfCarry, bool carry);
+	uint8_t readFlags();
+	void writeFlags(uint8_t value);
+	void recordFlags(FlagOperation operation, uint8_t left, uint8_t right, uint8_t result, bool carry);
+	void resolveFlags();
+	bool pendingCarry();
+	bool branchTaken(uint8_t opCode);
+	template<AluOperation OP> void alu(uint8_t value);
+	template<ShiftOperation OP> uint8_t rotateShift(uint8_t value);
+
+	//base opcode handlers
+	void opNop(uint8_t opCode);
+	void opLdPairImmediate(uint8_t opCode);
+	void opStoreAccumulator(uint8_t opCode);
+	void opLoadAccumulator(uint8_t opCode);
+	void opIncPair(uint8_t opCode);
+	void opDecPair(uint8_t opCode);
+	template<Operand R> void opIncOperand(uint8_t opCode);
+	template<Operand R> void opDecOperand(uint8_t opCode);
+	template<Operand R> void opLdOperandImmediate(uint8_t opCode);
+	void opRlca(uint8_t opCode);
+	void opRrca(uint8_t opCode);
+	void opRla(uint8_t opCode);
+	void opRra(uint8_t opCode);
+	void opLdAddressSP(uint8_t opCode);
+	void opAddHLPair(uint8_t opCode);
+	void opStop(uint8_t opCode);
+	void opJr(uint8_t opCode);
+	void opJrConditional(uint8_t opCode);
+	void opDaa(uint8_t opCode);
+	void opCpl(uint8_t opCode);
+	void opScf(uint8_t opCode);
+	void opCcf(uint8_t opCode);
+	template<Operand DST, Operand SRC> void opLdOperandOperand(uint8_t opCode);
+	void opHalt(uint8_t opCode);
+	template<AluOperation OP, Operand R> void opAluOperand(uint8_t opCode);
+	template<AluOperation OP> void opAluImmediate(uint8_t opCode);
+	void opRet(uint8_t opCode);
+	void opReti(uint8_t opCode);
+	void opRetConditional(uint8_t opCode);
+	void opPop(uint8_t opCode);
+	void opPush(uint8_t opCode);
+	void opJp(uint8_t opCode);
+	void opJpConditional(uint8_t opCode);
+	void opJpHL(uint8_t opCode);
+	void opCall(uint8_t opCode);
+	void opCallConditional(uint8_t opCode);
+	void opRst(uint8_t opCode);
+	void opPrefixCB(uint8_t opCode);
+	void opLdhAddressA(uint8_t opCode);
+	void opLdhAAddress(uint8_t opCode);
+	void opLdhCA(uint8_t opCode);
+	void opLdhAC(uint8_t opCode);
+	void opLdAddressA(uint8_t opCode);
+	void opLdAAddress(uint8_t opCode);
+	void opAddSPImmediate(uint8_t opCode);
+	void opLdHLSPImmediate(uint8_t opCode);
+	void opLdSPHL(uint8_t opCode);
+	void opDi(uint8_t opCode);
+	void opEi(uint8_t opCode);
+	void opIllegal(uint8_t opCode);
+
+	//CB prefixed opcode handlers
+	template<ShiftOperation OP, Operand R> void cbRotateShift(uint8_t opCode);
+	template<int BIT, Operand R> void cbBit(uint8_t opCode);
+	template<int BIT, Operand R> void cbRes(uint8_t opCode);
+	template<int BIT, Operand R> void cbSet(uint8_t opCode);
 };
 
-CPU::CPU(Memory* memPtr, int clock)
+CPU::CPU(Memory* memPtr) : registers(memPtr->getState()->registers), scheduler(&registers.cycles, &memPtr->getState()->scheduler), blockCache(memPtr)
 {
 	this->memory = memPtr;
-	this->CLOCK = clock;
+	memPtr->mapIo(0xFF0F, this, &CPU::readInterruptRegister, &CPU::writeInterruptRegister);
+	memPtr->mapIo(0xFFFF, this, &CPU::readInterruptRegister, &CPU::writeInterruptRegister);
+#ifdef DYNAMIC_RECOMPILER_ENABLED
+	this->recompiler.setLayout(this->getGuestLayout(), this);
+#endif
 }
 bool CPU::getInteruptStatus()
 {
-	return this->interruptsEnabled;
+	return this->registers.interruptsEnabled;
 }
 void CPU::setInteruptStatus(bool newIntStatus)
 {
-	this->interruptsEnabled = newIntStatus;
+	this->registers.interruptsEnabled = newIntStatus;
+	//an interrupt that was already pending has to be taken before the next instruction
+	if (newIntStatus && this->registers.cpuState == RUNNING)
+		this->registers.cpuState = INTERRUPT;
 }
 void CPU::stepCPU()
 {
-	//execute boot rom
-
-	//execute rom code
-	int cartSize = this->memory->getCartRomSize();
-	uint8_t* cartRom = this->memory->getCartRom();
-	bool instructionCaught = true;
-	int cyclesLeft = 0;
-	while(instructionCaught)
+	//the boot ROM is mapped at 0000 until it writes FF50, so both it and the rom code run from here.
+	//only returns once the CPU locks up, or halts with nothing scheduled that could wake it
+	this->runUntil(UINT64_MAX);
+}
+//starts at the cartridge entry point in the state the DMG boot ROM hands over in, without running it.
+//Components have to be attached first so the IO writes reach them
+void CPU::skipBootRom()
+{
+	this->registers.AF.high = 0x01;
+	this->writeFlags(0xB0);
+	this->registers.BC.pair = 0x0013;
+	this->registers.DE.pair = 0x00D8;
+	this->registers.HL.pair = 0x014D;
+	this->registers.SP = 0xFFFE;
+	this->registers.PC = 0x0100;
+	for (const uint16_t* entry : postBootIo)
+	{
+		this->memory->write(entry[0], (uint8_t)entry[1]);
+	}
+	this->memory->write(0xFF50, 0x01);
+}
+//runs for at least the given number of clock cycles and returns how many actually ran. It stops at the
+//first instruction boundary past the budget, so the last instruction can take it a few cycles over
+uint64_t CPU::runCycles(uint64_t cycles)
+{
+	uint64_t start = this->registers.cycles;
+	return this->runUntil(start + cycles) - start;
+}
+//runs until the cycle counter reaches cycle (or the CPU locks up), returns the counter.
+//The engines only ever run up to the next scheduled event, which is dispatched before carrying on
+uint64_t CPU::runUntil(uint64_t cycle)
+{
+	while (this->registers.cycles < cycle && this->registers.cpuState != LOCKED)
+	{
+		uint64_t nextEvent = this->scheduler.nextEventCycle();
+		if (nextEvent <= this->registers.cycles)
+		{
+			this->scheduler.dispatch();
+			nextEvent = this->scheduler.nextEventCycle();
+		}
+		//IF, IE or IME changed, the engine handed control back so it can be acted on
+		if (this->registers.cpuState == INTERRUPT)
+			this->registers.cpuState = RUNNING;
+		this->serviceInterrupts();
+		uint64_t sliceEnd = nextEvent < cycle ? nextEvent : cycle;
+		if (this->registers.cpuState == HALT || this->registers.cpuState == STOP)
+		{
+			//only an event can raise the interrupt that wakes the CPU, so the clock skips straight to it
+			this->registers.cycles = sliceEnd;
+			continue;
+		}
+#ifdef THREADED_DISPATCH_ENABLED
+		this->runThreaded(sliceEnd);
+#else
+		this->executeBlock(sliceEnd);
+#endif
+	}
+	return this->registers.cycles;
+}
+//runs until the PPU has started its next vertical blank, LY 144 in VBlank mode on return. With the LCD
+//off there is no frame to wait for and a frame's worth of cycles runs instead. False once the CPU has locked up
+bool CPU::runFrame()
+{
+	const PpuState* ppu = &this->memory->getState()->ppu;
+	uint64_t frames = ppu->frameCount;
+	uint64_t budgetEnd = this->registers.cycles + PPU::CYCLES_PER_FRAME;
+	while (ppu->frameCount == frames && this->registers.cpuState != LOCKED)
+	{
+		//the LCD can be switched either way in the middle, so the target is worked out again after each PPU event
+		uint64_t next = (ppu->lcdc & 0x80) ? this->scheduler.getDeadline(EVENT_PPU) : Scheduler::NEVER;
+		if (next == Scheduler::NEVER)
+		{
+			if (this->registers.cycles >= budgetEnd)
+				break;
+			//a line at a time, the VBlank of an LCD switched on here is still more than a line off
+			next = min(budgetEnd, this->registers.cycles + PPU::CYCLES_PER_LINE);
+		}
+		this->runUntil(next);
+		//runUntil stops on the cycle of the event without handling it, the VBlank has to have begun
+		if (this->scheduler.nextEventCycle() <= this->registers.cycles)
+			this->scheduler.dispatch();
+	}
+	return this->registers.cpuState != LOCKED;
+}
+uint64_t CPU::getCycleCount()
+{
+	return this->registers.cycles;
+}
+//components register their events here
+Scheduler* CPU::getScheduler()
+{
+	return &this->scheduler;
+}
+//bytes saveState writes, the same for every instance running the same cartridge
+size_t CPU::getStateSize()
+{
+	return this->memory->getStateSize();
+}
+//copies the whole machine (CPU, memory, cartridge and component state) out of the arena
+void CPU::saveState(void* buffer)
+{
+	memcpy(buffer, this->memory->getState(), this->memory->getStateSize());
+}
+//only between runs, the buffer has to come from saveState of an instance running the same cartridge
+void CPU::loadState(const void* buffer)
+{
+	memcpy(this->memory->getState(), buffer, this->memory->getStateSize());
+	this->memory->reloadState();
+	this->scheduler.reload();
+}
+//jumps to the highest priority pending interrupt. HALT ends on any pending interrupt, even with IME off
+void CPU::serviceInterrupts()
+{
+	uint8_t pending = this->registers.interruptFlags & this->registers.interruptEnable & 0x1F;
+	if (pending == 0)
+		return;
+	if (this->registers.cpuState == HALT)
+		this->registers.cpuState = RUNNING;
+	if (!this->registers.interruptsEnabled)
+		return;
+	int index = 0;
+	while (!(pending & (1 << index)))
 	{
-		Instruction instruction;
-		instruction.setOpCode(this->memory->read(this->programCounter));
-		instructionCaught = this->executeInstruction(instruction, this->programCounter, cartRom[this->programCounter + 1], cartRom, cyclesLeft);
+		index++;
 	}
+	this->registers.interruptFlags &= ~(1 << index);
+	this->registers.interruptsEnabled = false;
+	this->pushWord(this->registers.PC);
+	this->registers.PC = 0x40 + index * 8;
+	this->registers.cycles += 20;
+}
+//IF (FF0F) and IE (FFFF)
+uint8_t CPU::readInterruptRegister(void* component, uint16_t address)
+{
+	CPU* cpu = static_cast<CPU*>(component);
+	if (address == 0xFF0F)
+		return cpu->registers.interruptFlags | 0xE0;
+	return cpu->registers.interruptEnable;
+}
+void CPU::writeInterruptRegister(void* component, uint16_t address, uint8_t value)
+{
+	CPU* cpu = static_cast<CPU*>(component);
+	if (address == 0xFF0F)
+		cpu->registers.interruptFlags = value & 0x1F;
+	else
+		cpu->registers.interruptEnable = value;
+	if (cpu->registers.cpuState == RUNNING)
+		cpu->registers.cpuState = INTERRUPT;
 }
 void CPU::setCpuState(CpuState newState)
 {
-	this->cpuState = newState;
+	this->registers.cpuState = newState;
 }
 CpuState CPU::getCpuState()
 {
-	return this->cpuState;
+	return this->registers.cpuState;
 }
-bool CPU::executeInstruction(Instruction instruction, uint16_t &PC, uint8_t nextOpCode, uint8_t* memory, int &cyclesLeft)
+bool CPU::executeInstruction(Instruction instruction)
 {
-	Instruction instructionPrefix;
-	bool instructionCaught = false;
-	uint8_t reg1 = 0, reg2 = 0, result = 0, msb = 0, lsb = 0;
-	uint16_t reg116 = 0, reg216 = 0, addr = 0;
-
-
-	switch (instruction.getOpCode())
+	uint8_t opCode = instruction.getOpCode();
+	uint16_t address = this->registers.PC;
+	this->loadOperands(opCode);
+	this->traceFetched(address, opCode);
+	(this->*baseTable[opCode])(opCode);
+	return this->registers.cpuState != LOCKED;
+}
+//runs the predecoded block at the PC, decoding it first if it is not cached
+//runs one block, or only as much of it as fits before the deadline
+void CPU::executeBlock(uint64_t deadline)
+{
+	DecodedBlock* block = this->blockCache.lookup(this->registers.PC);
+	if (block == nullptr)
+		block = this->decodeBlock(this->registers.PC);
+	if (this->registers.cycles + block->cycles > deadline)
 	{
-		// NOP Length: 1 Cycles 1 Opcode: 0x00 Flags: ----
-	case (uint8_t)0x00: instruction.setMnemonic("NOP");// DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		instructionCaught = true; 
-		break;
-		// LD BC d16 Length: 3 Cycles 12 Opcode: 0x01 Flags: ----
-	case (uint8_t)0x01: instruction.setMnemonic("LD BC d16");// DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		this->B.setValue(this->memory->read(PC));
-		PC++;
-		this->C.setValue(this->memory->read(PC));
-		instructionCaught = true;
-		break;
-		// LD (BC), A Length: 1 Cycles 8 Opcode: 0x02 Flags: ----
-	case (uint8_t)0x02: instruction.setMnemonic("LD (BC), A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = (this->B.getValue() << 8 | (this->C.getValue() & 0xFF));
-		this->memory->write(addr, this->A.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// INC BC Length: 1 Cycles 8 Opcode: 0x03 Flags: ----
-	case (uint8_t)0x03: instruction.setMnemonic("INC BC");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//add B to A
-		reg116 = (this->B.getValue()) << 8 | (this->C.getValue() & 0xFF);
-		//INC Register
-		reg116++;
-		//set top 8 bits to B register
-		this->B.setValue((uint8_t)(reg116 >> 8));
-		//cutoff B bits
-		reg116 = reg116 << 8;
-		//shift C bits back
-		reg116 = reg116 >> 8;
-		//set C to lower half
-		this->C.setValue((uint8_t)reg116);
-		instructionCaught = true;
-		break;
-		// INC B Length: 1 Cycles 4 Opcode: 0x04 Flags: Z0H-
-	case (uint8_t)0x04: instruction.setMnemonic("INC B"); //DONE
-		cout << instruction.getMnemonic() << endl;
-		//half carry
-		if (((this->B.getValue() & 0xF) + 1) & 0x10 == 0x10)
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		reg1 = this->B.getValue();
-		reg1++;
-		this->B.setValue(reg1);
-		//set subtraction flag zero
-		this->F.setValue(this->F.getValue() & 0b10111111);
-		//check for zero flag
-		if(this->B.getValue() == (uint8_t)0x00)
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// DEC B Length: 1 Cycles 4 Opcode: 0x05 Flags: Z1H-
-	case (uint8_t)0x05: instruction.setMnemonic("DEC B");// DONE
-		cout << instruction.getMnemonic() << endl;
-		if (((this->B.getValue() & 0xF) + -1) & 0x10 == 0x10)
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		reg1 = this->B.getValue();
-		reg1--;
-		this->B.setValue(reg1);
-		this->F.setValue(this->F.getValue() & 0b10111111);
-		if (this->B.getValue() == (uint8_t)0x00)
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		instructionCaught = true;
-		break;
-		// LD B d8 Length: 2 Cycles 8 Opcode: 0x06 Flags: ----
-	case (uint8_t)0x06: instruction.setMnemonic("LD B d8");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->B.setValue(memory[PC]);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RLCA Length: 1 Cycles 4 Opcode: 0x07 Flags: 000C
-	case (uint8_t)0x07: instruction.setMnemonic("RLCA");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//set carry flag
-		if (this->A.getValue() & 0b10000000 == 0x80)
-			this->F.setValue(this->F.getValue() | 0x10);
-		else
-			this->F.setValue(this->F.getValue() | 0x7F);
-		//get lowest bit
-		lsb = this->A.getValue() & 1;
-		this->A.setValue(this->A.getValue() >> 1 | lsb << 8);
-		if(this->A.getValue() == 0x00)
-			this->F.setValue(this->F.getValue() | 0x80);
-		this->F.setValue(this->F.getValue() & 0x9F);
-		instructionCaught = true;
-		break;
-		// LD (a16), SP Length: 3 Cycles 20 Opcode: 0x08 Flags: ----
-	case (uint8_t)0x08: instruction.setMnemonic("LD (a16), SP");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		this->stackPointer = memory[PC] << 8 | (memory[PC + 1] & 0xFF);
-		PC++;
-		instructionCaught = true;
-		break;
-		// ADD HL BC Length: 1 Cycles 8 Opcode: 0x09 Flags: -0HC
-	case (uint8_t)0x09: instruction.setMnemonic("ADD HL BC");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//combine registers
-		//HL
-		reg116 = (this->H.getValue()) << 8 | (this->L.getValue() & 0xFF);
-		//BC
-		reg216 = (this->B.getValue()) << 8 | (this->C.getValue() & 0xFF);
-		//check for half carry bit 11
-		if((((reg116 & 0xFFF)+(reg216 & 0xFFF)) & 0x1000) == 0x1000)
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		//check for carry (bit 15)
-		if ((((((unsigned int)reg116) & 0xFFFF) + (((unsigned int)reg216) & 0xFFFF)) & 0x10000) == 0x10000)
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		//set subtraction flag to 0
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		//perform addtion
-		result = reg116 + reg216;
-		//store results.
-		//set top 8 bits to B register
-		this->B.setValue((uint8_t)(reg216 >> 8));
-		//cutoff B bits
-		reg216 = reg216 << 8;
-		//shift C bits back
-		reg216 = reg216 >> 8;
-		//set C to lower half
-		this->C.setValue((uint8_t)reg216);
-		//set top 8 bits to B register
-		this->H.setValue((uint8_t)(reg116 >> 8));
-		//cutoff B bits
-		reg116 = reg116 << 8;
-		//shift C bits back
-		reg116 = reg116 >> 8;
-		//set C to lower half
-		this->L.setValue((uint8_t)reg116);
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD A, (BC) Length: 1 Cycles 8 Opcode: 0x0A Flags: ----
-	case (uint8_t)0x0A: instruction.setMnemonic("LD A, (BC)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = this->B.getValue() << 8 | (this->C.getValue() & 0xFF);
-		this->A.setValue(this->memory->read(addr));
-		PC++;
-		instructionCaught = true;
-		break;
-		// DEC BC Length: 1 Cycles 8 Opcode: 0x0B Flags: ----
-	case (uint8_t)0x0B: instruction.setMnemonic("DEC BC");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//get both values
-		//shift B left 7
-		//add B to A
-		reg116 = this->B.getValue() << 8 | (this->C.getValue() & 0xFF);
-		reg116--;
-		//set top 8 bits to B register
-		this->B.setValue((uint8_t)(reg116 >> 8));
-		//cutoff B bits
-		reg116 = reg116 << 8;
-		//shift C bits back
-		reg116 = reg116 >> 8;
-		//set C to lower half
-		this->C.setValue((uint8_t)reg116);
-		PC++;
-		instructionCaught = true;
-		break;
-		// INC C Length: 1 Cycles 4 Opcode: 0x0C Flags: Z0H-
-	case (uint8_t)0x0C: instruction.setMnemonic("INC C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//half carry
-		if (((this->C.getValue() & 0xF) + 1) & 0x10 == 0x10)
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		reg1 = this->C.getValue();
-		reg1++;
-		this->C.setValue(reg1);
-		//set subtraction flag zero
-		this->F.setValue(this->F.getValue() & 0b10111111);
-		//check for zero flag
-		if (this->C.getValue() == (uint8_t)0x00)
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		instructionCaught = true;
-		break;
-		// DEC C Length: 1 Cycles 4 Opcode: 0x0D Flags: Z1H-
-	case (uint8_t)0x0D: instruction.setMnemonic("DEC C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//half carry
-		if (((this->C.getValue() & 0xF) + 1) & 0x10 == 0x10)
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		reg1 = this->C.getValue();
-		reg1--;
-		this->C.setValue(reg1);
-		//set subtraction flag zero
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//check for zero flag
-		if (this->C.getValue() == (uint8_t)0x00)
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		instructionCaught = true;
-		break;
-		// LD C, d8 Length: 1 Cycles 4 Opcode: 0x0E Flags: ----
-	case (uint8_t)0x0E: instruction.setMnemonic("LD C, d8");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		this->C.setValue(memory[PC]);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RRCA Length: 1 Cycles 4 Opcode: 0x0F Flags: Z00C
-	case (uint8_t)0x0F: instruction.setMnemonic("RRCA");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//Handle Carry
-		lsb = this->A.getValue() & 0x1;
-		if (lsb == 1)
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		else
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		//shift right
-		reg1 = this->A.getValue() << 1;
-		//populate msb
-		reg1 = reg1 | lsb >> 8;
-		this->A.setValue(reg1);
-		//check zero flag
-		if(reg1 == 0x00)
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//reset sub and half carry
-		this->F.setValue(this->F.getValue() & 0b10010000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// STOP 0 Length: 2 Cycles 4 Opcode: 0x10 Flags: ----
-	case (uint8_t)0x10: instruction.setMnemonic("STOP 0");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->setCpuState(STOP);
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD DE, d16 Length: 3 Cycles 12 Opcode: 0x11 Flags: ----
-	case (uint8_t)0x11: instruction.setMnemonic("LD DE, d16");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		this->D.setValue(memory[PC]);
-		PC++;
-		this->E.setValue(memory[PC]);
-		instructionCaught = true;
-		break;
-		// LD (DE), A Length: 1 Cycles 8 Opcode: 0x12 Flags: ----
-	case (uint8_t)0x12: instruction.setMnemonic("LD (DE), A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = this->D.getValue() << 8 | (this->E.getValue() & 0xFF);
-		this->memory->write(addr, this->A.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// INC DE Length: 1 Cycles 8 Opcode: 0x13 Flags: ----
-	case (uint8_t)0x13: instruction.setMnemonic("INC DE");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//get both values
-		//shift D left 7
-		//add D to E
-		reg116 = this->D.getValue() << 8 | (this->E.getValue() & 0xFF);
-		//DEC Register
-		reg116++;
-		//set top 8 bits to B register
-		this->D.setValue((uint8_t)(reg116 >> 8));
-		//cutoff B bits
-		reg116 = reg116 << 8;
-		//shift C bits back
-		reg116 = reg116 >> 8;
-		//set C to lower half
-		this->E.setValue((uint8_t)reg116);
-		PC++;
-		instructionCaught = true;
-		break;
-		// INC D Length: 1 Cycles 4 Opcode: 0x14 Flags: Z0H-
-	case (uint8_t)0x14: instruction.setMnemonic("INC D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//half carry
-		if (((this->D.getValue() & 0xF) + 1) & 0x10 == 0x10)
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		reg1 = this->D.getValue();
-		reg1++;
-		this->D.setValue(reg1);
-		//set subtraction flag zero
-		this->F.setValue(this->F.getValue() & 0b10111111);
-		//check for zero flag
-		if (this->D.getValue() == (uint8_t)0x00)
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		instructionCaught = true;
-		break;
-		// DEC D Length: 1 Cycles 4 Opcode: 0x15 Flags: Z1H-
-	case (uint8_t)0x15: instruction.setMnemonic("DEC D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//half carry
-		if (((this->D.getValue() & 0xF) + 1) & 0x10 == 0x10)
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		reg1 = this->D.getValue();
-		reg1--;
-		this->D.setValue(reg1);
-		//set subtraction flag zero
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//check for zero flag
-		if (this->D.getValue() == (uint8_t)0x00)
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		instructionCaught = true;
-		break;
-		// LD D, d8 Length: 2 Cycles 8 Opcode: 0x16 Flags: ----
-	case (uint8_t)0x16: instruction.setMnemonic("LD D, d8");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		this->D.setValue(this->memory->read(PC));
-		PC++;
-		instructionCaught = true;
-		break;
-		// RLA Length: 1 Cycles 4 Opcode: 0x17 Flags: Z00C
-	case (uint8_t)0x17: instruction.setMnemonic("RLA");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//msb to carry
-		msb = this->A.getValue() << 7;
-		if (msb == 0x01)
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		else
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		reg1 = this->A.getValue() >> 1;
-		if(reg1 == 0x00)
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() & 0b00010000);
-		this->A.setValue(reg1);
-		instructionCaught = true;
-		break;
-		// JR r8 Length: 2 Cycles 12 Opcode: 0x18 Flags: ----
-	case (uint8_t)0x18: instruction.setMnemonic("JR r8");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		//read in offset
-		reg1 = this->memory->read(PC);
-		reg116 = 0;
-		if ((reg1 & 0x80) == 0x80)
-		{
-			//sign extend offset
-			reg116 = 0xFF00 | reg1;
-		}
-		else
-			reg116 = 0x0000 | reg1;
-		//perform "unsigned" addition to program counter
-		PC = PC + reg116;
-		//do not increment program counter
-		instructionCaught = true;
-		break;
-		// ADD HL, DE Length: 1 Cycles 8 Opcode: 0x19 Flags: -0HC
-	case (uint8_t)0x19: instruction.setMnemonic("ADD HL, DE");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//combine registers
-		//HL
-		reg116 = (this->H.getValue()) << 8 | (this->L.getValue() & 0xFF);
-		//BC
-		reg216 = (this->D.getValue()) << 8 | (this->E.getValue() & 0xFF);
-		//check for half carry bit 11
-		if ((((reg116 & 0xFFF) + (reg216 & 0xFFF)) & 0x1000) == 0x1000)
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		//check for carry (bit 15)
-		if ((((((unsigned int)reg116) & 0xFFFF) + (((unsigned int)reg216) & 0xFFFF)) & 0x10000) == 0x10000)
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		//set subtraction flag to 0
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		//perform addtion
-		result = reg116 + reg216;
-		//store results.
-		//set top 8 bits to B register
-		this->D.setValue((uint8_t)(reg216 >> 8));
-		//cutoff B bits
-		reg216 = reg216 << 8;
-		//shift C bits back
-		reg216 = reg216 >> 8;
-		//set C to lower half
-		this->E.setValue((uint8_t)reg216);
-		//set top 8 bits to B register
-		this->H.setValue((uint8_t)(reg116 >> 8));
-		//cutoff B bits
-		reg116 = reg116 << 8;
-		//shift C bits back
-		reg116 = reg116 >> 8;
-		//set C to lower half
-		this->L.setValue((uint8_t)reg116);
-		instructionCaught = true;
-		break;
-		// LD A, (DE) Length: 1 Cycles 8 Opcode: 0x1A Flags: ----
-	case (uint8_t)0x1A: instruction.setMnemonic("LD A, (DE)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = this->D.getValue() << 8 | (this->E.getValue() & 0xFF);
-		this->A.setValue(this->memory->read(addr));
-		PC++;
-		instructionCaught = true;
-		break;
-		// DEC DE Length: 1 Cycles 8 Opcode: 0x1B Flags: ----
-	case (uint8_t)0x1B: instruction.setMnemonic("DEC DE");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//get both values
-		//shift D left 7
-		//add D to E
-		reg116 = this->D.getValue() << 8 | (this->E.getValue() & 0xFF);
-		//DEC Register
-		reg116--;
-		//set top 8 bits to B register
-		this->D.setValue((uint8_t)(reg116 >> 8));
-		//cutoff B bits
-		reg116 = reg116 << 8;
-		//shift C bits back
-		reg116 = reg116 >> 8;
-		//set C to lower half
-		this->C.setValue((uint8_t)reg116);
-		PC++;
-		instructionCaught = true;
-		break;
-		// INC E Length: 1 Cycles 4 Opcode: 0x1C Flags: Z0H-
-	case (uint8_t)0x1C: instruction.setMnemonic("INC E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//check half carry
-		reg1 = this->E.getValue();
-		if (((reg1 & 0x0F) + 1) == 0x10)
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		else
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		//increment
-		reg1++;
-		//check zero and set sub flag
-		if (reg1 == 0x00)
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b00110000);
-		this->E.setValue(reg1);
-		//increment ProgramCounter
-		PC++;
-		instructionCaught = true;
-		break;
-		// DEC E Length: 1 Cycles 4 Opcode: 0x1D Flags: Z1H-
-	case (uint8_t)0x1D: instruction.setMnemonic("DEC E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//check half carry
-		reg1 = this->E.getValue();
-		if (((reg1 & (uint8_t)0x0F) - (uint8_t)1) == (uint8_t)0x10)
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		else
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		//decrement
-		reg1--;
-		//check zero and set sub flag
-		if (reg1 == 0x00)
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() & 0b01000000);
-		this->F.setValue(this->F.getValue() & 0b01110000);
-		this->E.setValue(reg1);
-		//increment ProgramCounter
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD E, d8 Length: 2 Cycles 8 Opcode: 0x1E Flags: ----
-	case (uint8_t)0x1E: instruction.setMnemonic("LD E, d8");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		this->E.setValue(this->memory->read(PC));
-		PC++;
-		instructionCaught = true;
-		break;
-		// RRA Length: 1 Cycles 4 Opcode: 0x1F Flags: 000C
-	case (uint8_t)0x1F: instruction.setMnemonic("RRA");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue();
-		lsb = reg1 & (uint8_t)0x1;
-		if (lsb == 0x0)
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		else
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		this->F.setValue(this->F.getValue() & 0b00010000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// JR NZ, r8 Length: 2 Cycles 12/8 Opcode: 0x20 Flags: ----
-	case (uint8_t)0x20: instruction.setMnemonic("JR NZ, r8");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		if ((this->F.getValue() & 0b10000000) == 0x00)
-		{
-			//get Data
-			reg1 = this->memory->read(PC);
-			//Extend Sign
-			if ((reg1 & 0x80) == 0x80)
-			{
-				//sign extend offset
-				reg116 = 0xFF00 | reg1;
-			}
-			else
-				reg116 = 0x0000 | reg1;
-			//perform jump
-			PC = PC + reg116;
-		}
-		else
-			PC++;
-		instructionCaught = true;
-		break;
-		// LD HL, d16 Length: 3 Cycles 12 Opcode: 0x21 Flags: ----
-	case (uint8_t)0x21: instruction.setMnemonic("LD HL, d16");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		this->H.setValue(this->memory->read(PC));
-		PC++;
-		this->L.setValue(this->memory->read(PC));
-		instructionCaught = true;
-		PC++;
-		break;
-		// LD (HL+), A Length: 1 Cycles 8 Opcode: 0x22 Flags: ----
-	case (uint8_t)0x22: instruction.setMnemonic("LD (HL+), A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//perform load//get both values
-		//shift D left 7
-		//add D to E
-		reg116 = this->H.getValue() << 8 | (this->L.getValue() & 0xFF);
-		this->memory->write(reg116, this->A.getValue());
-		//DEC Register
-		reg116++;
-		//set top 8 bits to B register
-		this->H.setValue((uint8_t)(reg116 >> 8));
-		//cutoff B bits
-		reg116 = reg116 << 8;
-		//shift C bits back
-		reg116 = reg116 >> 8;
-		//set C to lower half
-		this->L.setValue((uint8_t)reg116);
-		PC++;
-		instructionCaught = true;
-		break;
-		// INC HL Length: 1 Cycles 8 Opcode: 0x23 Flags: ----
-	case (uint8_t)0x23: instruction.setMnemonic("INC HL");//DONE
-		cout << instruction.getMnemonic() << endl;
-		instructionCaught = true;
-		//get both values
-		//shift D left 7
-		//add D to E
-		reg116 = this->H.getValue() << 8 | (this->L.getValue() & 0xFF);
-		//DEC Register
-		reg116++;
-		//set top 8 bits to B register
-		this->H.setValue((uint8_t)(reg116 >> 8));
-		//cutoff B bits
-		reg116 = reg116 << 8;
-		//shift C bits back
-		reg116 = reg116 >> 8;
-		//set C to lower half
-		this->L.setValue((uint8_t)reg116);
-		PC++;
-		break;
-		// INC H Length: 1 Cycles 4 Opcode: 0x24 Flags: Z0H-
-	case (uint8_t)0x24: instruction.setMnemonic("INC H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//half carry
-		if (((this->H.getValue() & 0xF) + 1) & 0x10 == 0x10)
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		reg1 = this->H.getValue();
-		reg1++;
-		this->H.setValue(reg1);
-		//set subtraction flag zero
-		this->F.setValue(this->F.getValue() & 0b10111111);
-		//check for zero flag
-		if (this->H.getValue() == (uint8_t)0x00)
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		instructionCaught = true;
-		break;
-		// DEC H Length: 1 Cycles 4 Opcode: 0x25 Flags: Z1H-
-	case (uint8_t)0x25: instruction.setMnemonic("DEC H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//half carry
-		if (((this->H.getValue() & 0xF) + 1) & 0x10 == 0x10)
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		reg1 = this->H.getValue();
-		reg1--;
-		this->H.setValue(reg1);
-		//set subtraction flag zero
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//check for zero flag
-		if (this->H.getValue() == (uint8_t)0x00)
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		instructionCaught = true;
-		break;
-		// LD H, d8 Length: 2 Cycles 8 Opcode: 0x26 Flags: ----
-	case (uint8_t)0x26: instruction.setMnemonic("LD H, d8");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		this->H.setValue(this->memory->read(PC));
-		PC++;
-		instructionCaught = true;
-		break;
-		// DAA Length: 1 Cycles 4 Opcode: 0x27 Flags: Z-0C
-	case (uint8_t)0x27: instruction.setMnemonic("DAA");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue();
-		if (this->F.getValue() & 0b01000000 == 0)
-		{
-			//carry
-			if (this->F.getValue() & 0b00010000 == 1 || reg1 > 0x99)
-			{
-				reg1 += 0x60;
-				this->F.setValue(this->F.getValue() | 0b00010000);
-			}
-			//halfcarry
-			if (this->F.getValue() & 0b00100000 == 1 || (reg1 & 0xF) > 0x09)
-			{
-				reg1 += 0x06;
-			}
-		}
-		else
+		for (const MicroOp &op : block->ops)
 		{
-			//carry
-			if (this->F.getValue() & 0b00010000 == 1)
-			{
-				reg1 -= 0x60;
-			}
-			//halfcarry
-			if (this->F.getValue() & 0b00100000 == 1)
-			{
-				reg1 -= 0x06;
-			}
+			if (!this->executeMicroOp(op, block) || this->registers.cycles >= deadline)
+				break;
 		}
-		if(reg1 == 0)
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		this->F.setValue(this->F.getValue() & 0b11010000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// JR Z, r8 Length: 2 Cycles 12/8 Opcode: 0x28 Flags: ----
-	case (uint8_t)0x28: instruction.setMnemonic("JR Z, r8");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		if (this->F.getValue() & 0b10000000 == 0x80)
-		{
-			//get value
-			reg1 = this->memory->read(PC);
-			reg116 = 0;
-			//check sign & Extend
-			if (reg1 & 0x80 == 1)
-			{
-				reg116 = 0xFF00 | reg1;
-			}
-			else
-			{
-				reg116 = 0x0000 | reg1;
-			}
-		}
-		else
-			PC++;
-		instructionCaught = true;
-		break;
-		// ADD HL, HL Length: 1 Cycles 8 Opcode: 0x29 Flags: -0HC
-	case (uint8_t)0x29: instruction.setMnemonic("ADD HL,HL");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//combine registers
-		//HL
-		reg116 = (this->H.getValue()) << 8 | (this->L.getValue() & 0xFF);
-		//check for half carry bit 11
-		if ((((reg116 & 0xFFF) + (reg116 & 0xFFF)) & 0x1000) == 0x1000)
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		//check for carry (bit 15)
-		if ((((((unsigned int)reg116) & 0xFFFF) + (((unsigned int)reg116) & 0xFFFF)) & 0x10000) == 0x10000)
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		//set subtraction flag to 0
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		//perform addtion
-		result = reg116 + reg116;
-		//store results.
-		//set top 8 bits to H register
-		this->H.setValue((uint8_t)(reg116 >> 8));
-		//cutoff H bits
-		reg116 = reg116 << 8;
-		//shift L bits back
-		reg116 = reg116 >> 8;
-		//set L to lower half
-		this->L.setValue((uint8_t)reg116);
-		instructionCaught = true;
-		break;
-		// LD A, (HL+) Length: 1 Cycles 8 Opcode: 0x2A Flags: ----
-	case (uint8_t)0x2A: instruction.setMnemonic("LD A, (HL+)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//perform load//get both values
-		//shift D left 7
-		//add D to E
-		reg116 = this->H.getValue() << 8 | (this->L.getValue() & 0xFF);
-		this->A.setValue(this->memory->read(reg116));
-		//DEC Register
-		reg116++;
-		//set top 8 bits to B register
-		this->H.setValue((uint8_t)(reg116 >> 8));
-		//cutoff B bits
-		reg116 = reg116 << 8;
-		//shift C bits back
-		reg116 = reg116 >> 8;
-		//set C to lower half
-		this->L.setValue((uint8_t)reg116);
-		PC++;
-		instructionCaught = true;
-		break;
-		// DEC HL Length: 1 Cycles 8 Opcode: 0x2B Flags: ----
-	case (uint8_t)0x2B: instruction.setMnemonic("DEC HL");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//get both values
-		//shift D left 7
-		//add D to E
-		reg116 = this->H.getValue() << 8 | (this->L.getValue() & 0xFF);
-		//DEC Register
-		reg116--;
-		//set top 8 bits to B register
-		this->H.setValue((uint8_t)(reg116 >> 8));
-		//cutoff B bits
-		reg116 = reg116 << 8;
-		//shift C bits back
-		reg116 = reg116 >> 8;
-		//set C to lower half
-		this->L.setValue((uint8_t)reg116);
-		PC++;
-		instructionCaught = true;
-		break;
-		// INC L Length: 1 Cycles 4 Opcode: 0x2C Flags: Z0H-
-	case (uint8_t)0x2C: instruction.setMnemonic("INC L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//check half carry
-		reg1 = this->L.getValue();
-		if (((reg1 & 0x0F) + 1) == 0x10)
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		else
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		//increment
-		reg1++;
-		//check zero and set sub flag
-		if (reg1 == 0x00)
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b00110000);
-		//store value
-		this->L.setValue(reg1);
-		//increment ProgramCounter
-		PC++;
-		instructionCaught = true;
-		break;
-		// DEC L Length: 1 Cycles 4 Opcode: 0x2D Flags: Z1H-
-	case (uint8_t)0x2D: instruction.setMnemonic("DEC L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//check half carry
-		reg1 = this->L.getValue();
-		if (((reg1 & (uint8_t)0x0F) - (uint8_t)1) == (uint8_t)0x10)
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		else
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		//decrement
-		reg1--;
-		//check zero and set sub flag
-		if (reg1 == 0x00)
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() & 0b01000000);
-		this->F.setValue(this->F.getValue() & 0b01110000);
-		//store
-		this->L.setValue(reg1);
-		//increment ProgramCounter
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD L, d8 Length: 2 Cycles 8 Opcode: 0x2E Flags: ----
-	case (uint8_t)0x2E: instruction.setMnemonic("LD L, d8");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		this->L.setValue(this->memory->read(PC));
-		PC++;
-		instructionCaught = true;
-		break;
-		// CPL Length: 1 Cycles 4 Opcode: 0x2F Flags: -11-
-	case (uint8_t)0x2F: instruction.setMnemonic("CPL");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->A.setValue(this->A.getValue() ^ 0b11111111);
-		this->F.setValue(this->F.getValue() | 0b01100000);
-		instructionCaught = true;
-		break;
-		// JR NC, r8 Length: 2 Cycles 12/8 Opcode: 0x30 Flags: ----
-	case (uint8_t)0x30: instruction.setMnemonic("JR NC, r8");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		if ((this->F.getValue() & 0b00010000) == 0x00)
-		{
-			//get Data
-			reg1 = this->memory->read(PC);
-			//Extend Sign
-			if ((reg1 & 0x80) == 0x80)
-			{
-				//sign extend offset
-				reg116 = 0xFF00 | reg1;
-			}
-			else
-				reg116 = 0x0000 | reg1;
-			//perform jump
-			PC += reg116;
-		}
-		else
-			PC++;
-		instructionCaught = true;
-		break;
-		// LD HL, d16 Length: 3 Cycles 12 Opcode: 0x31 Flags: ----
-	case (uint8_t)0x31: instruction.setMnemonic("LD HL, d16");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		this->H.setValue(this->memory->read(PC));
-		PC++;
-		this->L.setValue(this->memory->read(PC));
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD (HL-), A Length: 1 Cycles 8 Opcode: 0x32 Flags: ----
-	case (uint8_t)0x32: instruction.setMnemonic("LD (HL-), A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//perform load//get both values
-		//shift D left 7
-		//add D to E
-		reg116 = this->H.getValue() << 8 | (this->L.getValue() & 0xFF);
-		this->memory->write(reg116, this->A.getValue());
-		//DEC Register
-		reg116--;
-		//set top 8 bits to B register
-		this->H.setValue((uint8_t)(reg116 >> 8));
-		//cutoff B bits
-		reg116 = reg116 << 8;
-		//shift C bits back
-		reg116 = reg116 >> 8;
-		//set C to lower half
-		this->L.setValue((uint8_t)reg116);
-		PC++;
-		instructionCaught = true;
-		break;
-		// INC SP Length: 1 Cycles 8 Opcode: 0x33 Flags: ----
-	case (uint8_t)0x33: instruction.setMnemonic("INC SP");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->stackPointer++;
-		PC++;
-		instructionCaught = true;
-		break;
-		// INC (HL) Length: 1 Cycles 12 Opcode: 0x34 Flags: Z0H-
-	case (uint8_t)0x34: instruction.setMnemonic("INC (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//get HL Addres
-		addr = this->H.getValue() >> 8 | (this->L.getValue() & 0xFF);
-		//get value from ram
-		reg1 = this->memory->read(addr);
-		//check half carry
-		if (((this->F.getValue() & 0xF) + 1) == 0x10)
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		else
-			this->F.setValue(this->F.getValue() & 0b10010000);
-		//increment
-		reg1++;
-		//check zero & set sub flag
-		if(reg1 == 0 )
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		//store value
-		this->memory->write(addr, reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// DEC (HL) Length: 1 Cycles 8 Opcode: 0x35 Flags: Z1H-
-	case (uint8_t)0x35: instruction.setMnemonic("DEC (HL)");//DONE
-		//get HL Addres
-		addr = this->H.getValue() >> 8 | (this->L.getValue() & 0xFF);
-		//get value from ram
-		reg1 = this->memory->read(addr);
-		//check half carry
-		if (((this->F.getValue() & 0xF) - 1) == 0x10)
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		else
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		//increment
-		reg1--;
-		//check zero & set sub flag
-		if (reg1 == 0)
-			this->F.setValue(this->F.getValue() | 0b10000000);
+		return;
+	}
+#ifdef DYNAMIC_RECOMPILER_ENABLED
+	if (block->nativeCode == nullptr && !block->nativeRejected && ++block->executionCount >= Recompiler::HOT_THRESHOLD)
+		this->compileBlock(block);
+	if (block->nativeCode != nullptr)
+	{
+		//native code keeps F in a host register, it has to be resolved going in
+		this->readFlags();
+		this->currentBlock = block;
+		block->nativeCode(&this->registers);
+	}
+	else
+#endif
+	for (const MicroOp &op : block->ops)
+	{
+		if (!this->executeMicroOp(op, block))
+			break;
+	}
+	//the loop went round once more, so it will keep doing so until what it polls changes
+	if (block->idleLoop && this->registers.PC == block->startAddress && this->registers.cpuState == RUNNING)
+		this->skipIdleLoop(block, deadline);
+}
+//returns false when the rest of the block can no longer be trusted
+bool CPU::executeMicroOp(const MicroOp &op, DecodedBlock* block)
+{
+	if constexpr (TracePolicy::ENABLED)
+	{
+		this->readFlags();
+		if (op.prefixed)
+			this->trace.record(op.address, 0xCB, op.opCode, 0, op.cycles, this->registers);
 		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store value
-		this->memory->write(addr, reg1);
-		PC++;
-		cout << instruction.getMnemonic() << endl;
-		instructionCaught = true;
-		break;
-		// LD (HL), d8 Length: 2 Cycles 12 Opcode: 0x36 Flags: ----
-	case (uint8_t)0x36: instruction.setMnemonic("LD (HL), d8");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		addr = this->H.getValue() << 8 | (this->L.getValue() & 0xFF);
-		this->memory->write(addr, this->memory->read(PC));
-		PC++;
-		instructionCaught = true;
+			this->trace.record(op.address, op.opCode, op.operands[0], op.operands[1], op.cycles, this->registers);
+	}
+	this->operandPointer = op.operands;
+	this->registers.PC = op.address + op.length;
+	this->registers.cycles += op.cycles;
+	(this->*op.handler)(op.opCode);
+	//the op may have halted or changed the interrupt state, and a store may have overwritten
+	//the rest of this block or switched its bank
+	return this->registers.cpuState == RUNNING && (!(op.properties & OPCODE_WRITES_MEMORY) || this->blockCache.isValid(*block));
+}
+//records the instruction whose operands loadOperands just fetched
+void CPU::traceFetched(uint16_t address, uint8_t opCode)
+{
+	if constexpr (TracePolicy::ENABLED)
+	{
+		//lazy flags have to be in F before the registers are copied
+		this->readFlags();
+		uint8_t cycles = opCode == 0xCB ? cbOpcodes[this->operandPointer[0]].cycles : baseOpcodes[opCode].cycles;
+		this->trace.record(address, opCode, this->operandPointer[0], this->operandPointer[1], cycles, this->registers);
+	}
+}
+#ifdef DYNAMIC_RECOMPILER_ENABLED
+void CPU::compileBlock(DecodedBlock* block)
+{
+	//native code has no per instruction hook to trace from
+	if (TracePolicy::ENABLED || !this->recompiler.shouldCompile(*block))
+	{
+		block->nativeRejected = true;
+		return;
+	}
+	block->nativeCode = this->recompiler.compile(*block, &CPU::nativeFallback);
+	if (block->nativeCode == nullptr)
+	{
+		//arena is full, start over with only the blocks that are hot from now on
+		this->recompiler.reset();
+		this->blockCache.dropNativeCode();
+		block->nativeCode = this->recompiler.compile(*block, &CPU::nativeFallback);
+	}
+}
+//where the native code sees each guest register
+GuestLayout CPU::getGuestLayout()
+{
+	uint8_t* base = reinterpret_cast<uint8_t*>(&this->registers);
+	uint8_t* registers[8] = { &this->registers.BC.high, &this->registers.BC.low, &this->registers.DE.high, &this->registers.DE.low,
+		&this->registers.HL.high, &this->registers.HL.low, nullptr, &this->registers.AF.high };
+	GuestLayout layout;
+	for (int i = 0; i < 8; i++)
+	{
+		layout.registerOffset[i] = registers[i] == nullptr ? 0 : (int)(registers[i] - base);
+	}
+	layout.flagsOffset = (int)(&this->registers.AF.low - base);
+	layout.stackPointerOffset = (int)(reinterpret_cast<uint8_t*>(&this->registers.SP) - base);
+	layout.programCounterOffset = (int)(reinterpret_cast<uint8_t*>(&this->registers.PC) - base);
+	layout.cycleCountOffset = (int)(reinterpret_cast<uint8_t*>(&this->registers.cycles) - base);
+	return layout;
+}
+//called from native code for every op it has no translation for
+bool CPU::nativeFallback(CPU* cpu, const MicroOp* op)
+{
+	bool keepGoing = cpu->executeMicroOp(*op, cpu->currentBlock);
+	cpu->readFlags();
+	return keepGoing;
+}
+#endif
+DecodedBlock* CPU::decodeBlock(uint16_t address)
+{
+	DecodedBlock* block = this->blockCache.create(address);
+	int addr = address;
+	while (true)
+	{
+		MicroOp op;
+		op.address = addr;
+		op.opCode = this->memory->read(addr);
+		op.prefixed = op.opCode == 0xCB;
+		const OpcodeInfo* info = &baseOpcodes[op.opCode];
+		op.handler = baseTable[op.opCode];
+		op.operands[0] = info->length > 1 ? this->memory->read(addr + 1) : 0;
+		op.operands[1] = info->length > 2 ? this->memory->read(addr + 2) : 0;
+		if (op.prefixed)
+		{
+			//skip the prefix handler and call the CB handler directly
+			op.opCode = op.operands[0];
+			info = &cbOpcodes[op.opCode];
+			op.handler = cbTable[op.opCode];
+		}
+		op.length = info->length;
+		op.cycles = info->cycles;
+		op.properties = info->properties;
+		block->ops.push_back(op);
+		block->cycles += op.cycles;
+		block->lastPage = (addr + op.length - 1) >> 8;
+		addr += op.length;
+		if ((op.properties & OPCODE_ENDS_BLOCK) || block->ops.size() == BlockCache::MAX_BLOCK_OPS)
+			break;
+		//stay inside one bank and at most two pages, and never wrap past 0xFFFF
+		if (addr + 2 > 0xFFFF || (addr & 0xC000) != (address & 0xC000) || ((addr + 2) >> 8) > block->firstPage + 1)
+			break;
+	}
+	block->lastPageVersion = this->memory->getPageVersion(block->lastPage);
+	block->idleLoop = this->isIdleLoop(block);
+	return block;
+}
+//A loop back to its own start that does nothing but load A from memory and test it. Until a value it
+//reads changes every iteration does exactly the same thing, like LDH A,(FF44); CP 144; JR NZ
+bool CPU::isIdleLoop(const DecodedBlock* block)
+{
+	const MicroOp &last = block->ops.back();
+	if (last.prefixed)
+		return false;
+	uint16_t target;
+	switch (last.opCode)
+	{
+	case 0x18: case 0x20: case 0x28: case 0x30: case 0x38:
+		target = last.address + last.length + (int8_t)last.operands[0];
 		break;
-		// SCF Length: 1 Cycles 8 Opcode: 0x37 Flags: -001
-	case (uint8_t)0x37: instruction.setMnemonic("SCF");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->F.setValue(this->F.getValue() | 0b00010000);
-		this->F.setValue(this->F.getValue() & 0b10010000);
-		instructionCaught = true;
+	case 0xC3: case 0xC2: case 0xCA: case 0xD2: case 0xDA:
+		target = last.operands[0] | (last.operands[1] << 8);
 		break;
-		// JR C, r8 Length: 2 Cycles 12/8 Opcode: 0x38 Flags: ----
-	case (uint8_t)0x38: instruction.setMnemonic("JR C, r8");//DONE
-		PC++;
-		if (this->F.getValue() & 0x10 == 0x10)
+	default:
+		return false;
+	}
+	if (target != block->startAddress)
+		return false;
+	//AND, XOR and OR overwrite A, which must have been reloaded by then to come out the same every time
+	bool reloaded = false;
+	for (size_t i = 0; i + 1 < block->ops.size(); i++)
+	{
+		const MicroOp &op = block->ops[i];
+		if (op.prefixed)
 		{
-			reg1 = this->memory->read(PC);
-			if ((reg1 & 0x80) == 0x80)
-			{
-				//sign extend
-				reg116 = 0xFF00 | reg1;
-			}
-			else
-			{
-				reg116 = 0x0000 | reg1;
-			}
-			//perform arithmetic
-			PC += reg116;
+			//BIT only sets flags
+			if ((op.opCode & 0xC0) != 0x40)
+				return false;
 		}
-		else
+		else if (op.opCode == 0xF0 || op.opCode == 0xFA || op.opCode == 0xF2 || op.opCode == 0x0A || op.opCode == 0x1A || op.opCode == 0x7E)
+			reloaded = true;
+		else if ((op.opCode >= 0xB8 && op.opCode <= 0xBF) || op.opCode == 0xFE || op.opCode == 0x00)
+			continue;
+		else if ((op.opCode >= 0xA0 && op.opCode <= 0xB7) || op.opCode == 0xE6 || op.opCode == 0xEE || op.opCode == 0xF6)
 		{
-			PC++;
+			if (!reloaded)
+				return false;
 		}
-		cout << instruction.getMnemonic() << endl;
-		instructionCaught = true;
-		break;
-		// ADD HL, SP Length: 1 Cycles 8 Opcode: 0x39 Flags: -0HC
-	case (uint8_t)0x39: instruction.setMnemonic("ADD HL, SP");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg116 = this->H.getValue() >> 8 | (this->L.getValue() & 0xFF);
-		//check for half carry bit 11
-		if ((((reg116 & 0xFFF) + (stackPointer & 0xFFF)) & 0x1000) == 0x1000)
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		//check for carry (bit 15)
-		if ((((((unsigned int)reg116) & 0xFFFF) + (((unsigned int)stackPointer) & 0xFFFF)) & 0x10000) == 0x10000)
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		//set subtraction flag to 0
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		reg116 += stackPointer;
-		//store value
-		this->H.setValue((uint8_t)(reg116 >> 8));
-		//cutoff B bits
-		reg116 = reg116 << 8;
-		//shift C bits back
-		reg116 = reg116 >> 8;
-		//set C to lower half
-		this->L.setValue((uint8_t)reg116);
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD A, (HL-) Length: 1 Cycles 8 Opcode: 0x3A Flags: ----
-	case (uint8_t)0x3A: instruction.setMnemonic("LD A, (HL-)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//perform load//get both values
-		//shift D left 7
-		//add D to E
-		reg116 = this->H.getValue() << 8 | (this->L.getValue() & 0xFF);
-		this->A.setValue(this->memory->read(reg116));
-		//DEC Register
-		reg116--;
-		//set top 8 bits to B register
-		this->H.setValue((uint8_t)(reg116 >> 8));
-		//cutoff B bits
-		reg116 = reg116 << 8;
-		//shift C bits back
-		reg116 = reg116 >> 8;
-		//set C to lower half
-		this->L.setValue((uint8_t)reg116);
-		PC++;
-		instructionCaught = true;
-		break;
-		// DEC SP Length: 1 Cycles 8 Opcode: 0x3B Flags: ----
-	case (uint8_t)0x3B: instruction.setMnemonic("DEC SP");//DONE
-		cout << instruction.getMnemonic() << endl;
-		stackPointer--;
-		PC++;
-		instructionCaught = true;
-		break;
-		// INC A Length: 1 Cycles 4 Opcode: 0x3C Flags: Z0H-
-	case (uint8_t)0x3C: instruction.setMnemonic("INC A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//check half carry
-		reg1 = this->A.getValue();
-		if (((reg1 & 0x0F) + 1) == 0x10)
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		else
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		//increment
-		reg1++;
-		//check zero and set sub flag
-		if (reg1 == 0x00)
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b00110000);
-		//store
-		this->A.setValue(reg1);
-		//increment ProgramCounter
-		PC++;
-		instructionCaught = true;
-		break;
-		// DEC A Length: 1 Cycles 4 Opcode: 0x3D Flags: Z1H-
-	case (uint8_t)0x3D: instruction.setMnemonic("DEC A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//check half carry
-		reg1 = this->A.getValue();
-		if (((reg1 & (uint8_t)0x0F) - (uint8_t)1) == (uint8_t)0x10)
-			this->F.setValue(this->F.getValue() | 0b00100000);
 		else
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		//decrement
-		reg1--;
-		//check zero and set sub flag
-		if (reg1 == 0x00)
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() & 0b01000000);
-		this->F.setValue(this->F.getValue() & 0b01110000);
-		//store
-		this->A.setValue(reg1);
-		//increment ProgramCounter
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD A, d8 Length: 2 Cycles 8 Opcode: 0x3E Flags: ----
-	case (uint8_t)0x3E: instruction.setMnemonic("LD A, d8");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		this->A.setValue(this->memory->read(PC));
-		PC++;
-		instructionCaught = true;
-		break;
-		// CCF Length: 1 Cycles 4 Opcode: 0x3F Flags: -00C
-	case (uint8_t)0x3F: instruction.setMnemonic("CCF");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->F.setValue(this->F.getValue() & 0b10000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD B, B Length: 1 Cycles 4 Opcode: 0x40 Flags: ----
-	case (uint8_t)0x40: instruction.setMnemonic("LD B, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->B.setValue(this->B.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD B, C Length: 1 Cycles 4 Opcode: 0x41 Flags: ----
-	case (uint8_t)0x41: instruction.setMnemonic("LD B, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->B.setValue(this->C.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD B, D Length: 1 Cycles 4 Opcode: 0x42 Flags: ----
-	case (uint8_t)0x42: instruction.setMnemonic("LD B, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		instructionCaught = true;
-		break;
-		// LD B, E Length: 1 Cycles 4 Opcode: 0x43 Flags: ----
-	case (uint8_t)0x43: instruction.setMnemonic("LD B, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->B.setValue(this->E.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD B, H Length: 1 Cycles 4 Opcode: 0x44 Flags: ----
-	case (uint8_t)0x44: instruction.setMnemonic("LD B, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->B.setValue(this->H.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD B, L Length: 1 Cycles 4 Opcode: 0x45 Flags: ----
-	case (uint8_t)0x45: instruction.setMnemonic("LD B, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->B.setValue(this->L.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD B, (HL) Length: 1 Cycles 8 Opcode: 0x40 Flags: ----
-	case (uint8_t)0x46: instruction.setMnemonic("LD B, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = this->H.getValue() << 8 | (this->L.getValue() & 0xFF);
-		this->B.setValue(this->memory->read(addr));
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD B, A Length: 1 Cycles 4 Opcode: 0x47 Flags: ----
-	case (uint8_t)0x47: instruction.setMnemonic("LD B, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->B.setValue(this->A.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD C, B Length: 1 Cycles 4 Opcode: 0x48 Flags: ----
-	case (uint8_t)0x48: instruction.setMnemonic("LD C, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->C.setValue(this->B.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD C, C Length: 1 Cycles 4 Opcode: 0x49 Flags: ----
-	case (uint8_t)0x49: instruction.setMnemonic("LD C, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->C.setValue(this->C.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD C, D Length: 1 Cycles 4 Opcode: 0x4A Flags: ----
-	case (uint8_t)0x4A: instruction.setMnemonic("LD C, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->C.setValue(this->D.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD C, E Length: 1 Cycles 4 Opcode: 0x4B Flags: ----
-	case (uint8_t)0x4B: instruction.setMnemonic("LD C, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->C.setValue(this->E.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD C, H Length: 1 Cycles 4 Opcode: 0x4C Flags: ----
-	case (uint8_t)0x4C: instruction.setMnemonic("LD C, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->C.setValue(this->H.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD C, L Length: 1 Cycles 4 Opcode: 0x4D Flags: ----
-	case (uint8_t)0x4D: instruction.setMnemonic("LD C, L");//DONE
-		this->C.setValue(this->L.getValue());
-		PC++;
-		cout << instruction.getMnemonic() << endl;
-		instructionCaught = true;
-		break;
-		// LD C, (HL) Length: 1 Cycles 8 Opcode: 0x4E Flags: ----
-	case (uint8_t)0x4E: instruction.setMnemonic("LD C, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = this->H.getValue() << 8 | (this->L.getValue() & 0xFF);
-		this->C.setValue(this->memory->read(addr));
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD C, A Length: 1 Cycles 4 Opcode: 0x4F Flags: ----
-	case (uint8_t)0x4F: instruction.setMnemonic("LD C, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->C.setValue(this->A.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD D, B Length: 1 Cycles 4 Opcode: 0x50 Flags: ----
-	case (uint8_t)0x50: instruction.setMnemonic("LD D, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->D.setValue(this->B.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD D, C Length: 1 Cycles 4 Opcode: 0x51 Flags: ----
-	case (uint8_t)0x51: instruction.setMnemonic("LD D, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->D.setValue(this->C.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD D, D Length: 1 Cycles 4 Opcode: 0x52 Flags: ----
-	case (uint8_t)0x52: instruction.setMnemonic("LD D, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->D.setValue(this->D.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD D, E Length: 1 Cycles 4 Opcode: 0x53 Flags: ----
-	case (uint8_t)0x53: instruction.setMnemonic("LD D, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->D.setValue(this->E.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD D, H Length: 1 Cycles 4 Opcode: 0x54 Flags: ----
-	case (uint8_t)0x54: instruction.setMnemonic("LD D, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->D.setValue(this->H.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD D, L Length: 1 Cycles 4 Opcode: 0x55 Flags: ----
-	case (uint8_t)0x55: instruction.setMnemonic("LD D, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->D.setValue(this->L.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD D, (HL) Length: 1 Cycles 8 Opcode: 0x56 Flags: ----
-	case (uint8_t)0x56: instruction.setMnemonic("LD D, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = this->H.getValue() << 8 | (this->L.getValue() & 0xFF);
-		this->D.setValue(this->memory->read(addr));
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD D, A Length: 1 Cycles 4 Opcode: 0x57 Flags: ----
-	case (uint8_t)0x57: instruction.setMnemonic("LD D, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->D.setValue(this->A.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD E, B Length: 1 Cycles 4 Opcode: 0x58 Flags: ----
-	case (uint8_t)0x58: instruction.setMnemonic("LD E, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->E.setValue(this->B.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD E, C Length: 1 Cycles 4 Opcode: 0x59 Flags: ----
-	case (uint8_t)0x59: instruction.setMnemonic("LD E, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->E.setValue(this->C.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD E, D Length: 1 Cycles 4 Opcode: 0x5A Flags: ----
-	case (uint8_t)0x5A: instruction.setMnemonic("LD E, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->E.setValue(this->D.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD E, E Length: 1 Cycles 4 Opcode: 0x5B Flags: ----
-	case (uint8_t)0x5B: instruction.setMnemonic("LD E, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->E.setValue(this->E.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD E, H Length: 1 Cycles 4 Opcode: 0x5C Flags: ----
-	case (uint8_t)0x5C: instruction.setMnemonic("LD E, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->E.setValue(this->H.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD E, L Length: 1 Cycles 4 Opcode: 0x5D Flags: ----
-	case (uint8_t)0x5D: instruction.setMnemonic("LD E, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->E.setValue(this->L.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD E, (HL) Length: 1 Cycles 4 Opcode: 0x5E Flags: ----
-	case (uint8_t)0x5E: instruction.setMnemonic("LD E, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = this->H.getValue() << 8 | (this->L.getValue() & 0xFF);
-		this->E.setValue(this->memory->read(addr));
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD E, A Length: 1 Cycles 4 Opcode: 0x5F Flags: ----
-	case (uint8_t)0x5F: instruction.setMnemonic("LD E, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->E.setValue(this->A.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD H, B Length: 1 Cycles 4 Opcode: 0x60 Flags: ----
-	case (uint8_t)0x60: instruction.setMnemonic("LD H, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->H.setValue(this->B.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD H, C Length: 1 Cycles 4 Opcode: 0x61 Flags: ----
-	case (uint8_t)0x61: instruction.setMnemonic("LD H, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->H.setValue(this->C.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD H, D Length: 1 Cycles 4 Opcode: 0x62 Flags: ----
-	case (uint8_t)0x62: instruction.setMnemonic("LD H, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->H.setValue(this->D.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD H, E Length: 1 Cycles 4 Opcode: 0x63 Flags: ----
-	case (uint8_t)0x63: instruction.setMnemonic("LD H, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->H.setValue(this->E.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD H, H Length: 1 Cycles 4 Opcode: 0x64 Flags: ----
-	case (uint8_t)0x64: instruction.setMnemonic("LD H, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->H.setValue(this->H.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD H, L Length: 1 Cycles 4 Opcode: 0x65 Flags: ----
-	case (uint8_t)0x65: instruction.setMnemonic("LD H, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->H.setValue(this->L.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD H, (HL) Length: 1 Cycles 8 Opcode: 0x66 Flags: ----
-	case (uint8_t)0x66: instruction.setMnemonic("LD H, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = this->H.getValue() << 8 | (this->L.getValue() & 0xFF);
-		this->H.setValue(this->memory->read(addr));
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD H, A Length: 1 Cycles 4 Opcode: 0x67 Flags: ----
-	case (uint8_t)0x67: instruction.setMnemonic("LD H, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->H.setValue(this->A.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD L, B Length: 1 Cycles 4 Opcode: 0x68 Flags: ----
-	case (uint8_t)0x68: instruction.setMnemonic("LD L, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->L.setValue(this->B.getValue());
-		PC++;
-		instructionCaught = true;
+			return false;
+	}
+	return true;
+}
+//the address the op reads, the registers it is taken from never change inside an idle loop
+bool CPU::getPolledAddress(const MicroOp &op, uint16_t &address)
+{
+	if (op.prefixed)
+	{
+		address = this->registers.HL.pair;
+		return (op.opCode & 0x07) == 6;
+	}
+	switch (op.opCode)
+	{
+	case 0xF0: address = 0xFF00 | op.operands[0]; return true;
+	case 0xFA: address = op.operands[0] | (op.operands[1] << 8); return true;
+	case 0xF2: address = 0xFF00 | this->registers.BC.low; return true;
+	case 0x0A: address = this->registers.BC.pair; return true;
+	case 0x1A: address = this->registers.DE.pair; return true;
+	case 0x7E: case 0xA6: case 0xAE: case 0xB6: case 0xBE: address = this->registers.HL.pair; return true;
+	default: return false;
+	}
+}
+//advances the clock by every whole iteration that would still finish before the deadline or before a
+//polled value changes. Events are never skipped since the deadline is at or before the next one
+void CPU::skipIdleLoop(DecodedBlock* block, uint64_t deadline)
+{
+	const MicroOp &last = block->ops.back();
+	uint64_t iteration = block->cycles + baseOpcodes[last.opCode].takenCycles - last.cycles;
+	uint64_t until = deadline;
+	for (const MicroOp &op : block->ops)
+	{
+		uint16_t address;
+		if (this->getPolledAddress(op, address))
+			until = min(until, this->memory->getNextChange(address));
+	}
+	uint64_t skipped = until > this->registers.cycles ? (until - this->registers.cycles - 1) / iteration : 0;
+	//it polls something that changes faster than it loops, checking again would only slow it down
+	if (skipped == 0 && until < deadline)
+		block->idleLoop = false;
+	this->registers.cycles += skipped * iteration;
+}
+#ifdef THREADED_DISPATCH_ENABLED
+//Every opcode gets its own label that runs the handler and then fetches and jumps to the
+//next opcode itself, so each of the 256 indirect jumps has its own branch predictor history
+//instead of all instructions sharing the one jump at the top of a central loop.
+#define THREADED_NEXT() \
+	opCode = this->memory->read(this->registers.PC); \
+	address = this->registers.PC; \
+	this->loadOperands(opCode); \
+	this->traceFetched(address, opCode); \
+	goto *labels[opCode]
+#define THREADED_OP(n) \
+	threaded_##n: \
+	(this->*baseTable[n])(n); \
+	if (this->registers.cycles >= deadline || this->registers.cpuState != RUNNING) \
+		return; \
+	THREADED_NEXT();
+#define THREADED_LABEL(n) &&threaded_##n,
+#define THREADED_ROW(row, X) \
+	X(row##0) X(row##1) X(row##2) X(row##3) X(row##4) X(row##5) X(row##6) X(row##7) \
+	X(row##8) X(row##9) X(row##A) X(row##B) X(row##C) X(row##D) X(row##E) X(row##F)
+#define THREADED_ALL(X) \
+	THREADED_ROW(0x0, X) THREADED_ROW(0x1, X) THREADED_ROW(0x2, X) THREADED_ROW(0x3, X) \
+	THREADED_ROW(0x4, X) THREADED_ROW(0x5, X) THREADED_ROW(0x6, X) THREADED_ROW(0x7, X) \
+	THREADED_ROW(0x8, X) THREADED_ROW(0x9, X) THREADED_ROW(0xA, X) THREADED_ROW(0xB, X) \
+	THREADED_ROW(0xC, X) THREADED_ROW(0xD, X) THREADED_ROW(0xE, X) THREADED_ROW(0xF, X)
+void CPU::runThreaded(uint64_t deadline)
+{
+	static void* const labels[256] = { THREADED_ALL(THREADED_LABEL) };
+	uint8_t opCode;
+	uint16_t address;
+	THREADED_NEXT();
+	THREADED_ALL(THREADED_OP)
+}
+#undef THREADED_ALL
+#undef THREADED_ROW
+#undef THREADED_LABEL
+#undef THREADED_OP
+#undef THREADED_NEXT
+#endif
+
+//Operand access
+//reads the operand bytes of the opcode at the PC and moves the PC to the next instruction
+void CPU::loadOperands(uint8_t opCode)
+{
+	uint8_t length = baseOpcodes[opCode].length;
+	if (length > 1)
+		this->operandBuffer[0] = this->memory->read(this->registers.PC + 1);
+	if (length > 2)
+		this->operandBuffer[1] = this->memory->read(this->registers.PC + 2);
+	this->operandPointer = this->operandBuffer;
+	this->registers.PC += length;
+	this->registers.cycles += opCode == 0xCB ? cbOpcodes[this->operandBuffer[0]].cycles : baseOpcodes[opCode].cycles;
+}
+//handlers run with the PC already on the next instruction and take their operands from here
+uint8_t CPU::fetchByte()
+{
+	uint8_t value = *this->operandPointer;
+	this->operandPointer++;
+	return value;
+}
+uint16_t CPU::fetchWord()
+{
+	uint8_t lsb = this->fetchByte();
+	uint8_t msb = this->fetchByte();
+	return (msb << 8) | lsb;
+}
+// resolved at compile time, so each handler instantiation touches exactly one register
+template<Operand R> uint8_t CPU::readOperand()
+{
+	if constexpr (R == REG_B) return this->registers.BC.high;
+	else if constexpr (R == REG_C) return this->registers.BC.low;
+	else if constexpr (R == REG_D) return this->registers.DE.high;
+	else if constexpr (R == REG_E) return this->registers.DE.low;
+	else if constexpr (R == REG_H) return this->registers.HL.high;
+	else if constexpr (R == REG_L) return this->registers.HL.low;
+	else if constexpr (R == REG_HL_PTR) return this->memory->read(this->registers.HL.pair);
+	else return this->registers.AF.high;
+}
+template<Operand R> void CPU::writeOperand(uint8_t value)
+{
+	if constexpr (R == REG_B) this->registers.BC.high = value;
+	else if constexpr (R == REG_C) this->registers.BC.low = value;
+	else if constexpr (R == REG_D) this->registers.DE.high = value;
+	else if constexpr (R == REG_E) this->registers.DE.low = value;
+	else if constexpr (R == REG_H) this->registers.HL.high = value;
+	else if constexpr (R == REG_L) this->registers.HL.low = value;
+	else if constexpr (R == REG_HL_PTR) this->memory->write(this->registers.HL.pair, value);
+	else this->registers.AF.high = value;
+}
+// index is the 2 bit register pair field of the opcode: BC, DE, HL, SP
+uint16_t CPU::readPair(uint8_t index)
+{
+	switch (index)
+	{
+	case 0: return this->registers.BC.pair;
+	case 1: return this->registers.DE.pair;
+	case 2: return this->registers.HL.pair;
+	default: return this->registers.SP;
+	}
+}
+void CPU::writePair(uint8_t index, uint16_t value)
+{
+	switch (index)
+	{
+	case 0: this->registers.BC.pair = value; break;
+	case 1: this->registers.DE.pair = value; break;
+	case 2: this->registers.HL.pair = value; break;
+	default: this->registers.SP = value; break;
+	}
+}
+void CPU::pushWord(uint16_t value)
+{
+	this->registers.SP--;
+	this->memory->write(this->registers.SP, (uint8_t)(value >> 8));
+	this->registers.SP--;
+	this->memory->write(this->registers.SP, (uint8_t)value);
+}
+uint16_t CPU::popWord()
+{
+	uint8_t lsb = this->memory->read(this->registers.SP);
+	this->registers.SP++;
+	uint8_t msb = this->memory->read(this->registers.SP);
+	this->registers.SP++;
+	return (msb << 8) | lsb;
+}
+bool CPU::getFlag(uint8_t flag)
+{
+	//every pending operation sets Z from its result, so the common JR NZ/JR Z test needs nothing else
+	if (flag == FLAG_ZERO && this->registers.flagOperation != FLAGS_RESOLVED)
+		return this->registers.flagResult == 0;
+	if (flag == FLAG_CARRY)
+		return this->pendingCarry();
+	return (this->readFlags() & flag) != 0;
+}
+void CPU::setFlags(bool zero, bool subtract, bool halfCarry, bool carry)
+{
+	this->writeFlags((zero ? FLAG_ZERO : 0) | (subtract ? FLAG_SUBTRACT : 0) | (halfCarry ? FLAG_HALF_CARRY : 0) | (carry ? FLAG_CARRY : 0));
+}
+uint8_t CPU::readFlags()
+{
+	if (this->registers.flagOperation != FLAGS_RESOLVED)
+		this->resolveFlags();
+	return this->registers.AF.low;
+}
+void CPU::writeFlags(uint8_t value)
+{
+	this->registers.AF.low = value;
+	this->registers.flagOperation = FLAGS_RESOLVED;
+}
+// carry is the carry in for ADD/SUB, the preserved C for INC/DEC and the carry out for AND/LOGIC
+void CPU::recordFlags(FlagOperation operation, uint8_t left, uint8_t right, uint8_t result, bool carry)
+{
+	this->registers.flagOperation = operation;
+	this->registers.flagLeft = left;
+	this->registers.flagRight = right;
+	this->registers.flagResult = result;
+	this->registers.flagCarry = carry;
+#ifndef LAZY_FLAGS
+	this->resolveFlags();
+#endif
+}
+void CPU::resolveFlags()
+{
+	uint8_t left = this->registers.flagLeft, right = this->registers.flagRight, result = this->registers.flagResult;
+	uint8_t carry = this->registers.flagCarry ? 1 : 0;
+	switch (this->registers.flagOperation)
+	{
+	case FLAGS_ADD:
+		this->setFlags(result == 0, false, ((left & 0xF) + (right & 0xF) + carry) > 0xF, (left + right + carry) > 0xFF);
 		break;
-		// LD L, C Length: 1 Cycles 4 Opcode: 0x69 Flags: ----
-	case (uint8_t)0x69: instruction.setMnemonic("LD L, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->L.setValue(this->C.getValue());
-		PC++;
-		instructionCaught = true;
+	case FLAGS_SUB:
+		this->setFlags(result == 0, true, (left & 0xF) < ((right & 0xF) + carry), left < (right + carry));
 		break;
-		// LD L, D Length: 1 Cycles 4 Opcode: 0x6A Flags: ----
-	case (uint8_t)0x6A: instruction.setMnemonic("LD L, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->L.setValue(this->D.getValue());
-		PC++;
-		instructionCaught = true;
+	case FLAGS_AND:
+		this->setFlags(result == 0, false, true, carry);
 		break;
-		// LD L, E Length: 1 Cycles 4 Opcode: 0x6B Flags: ----
-	case (uint8_t)0x6B: instruction.setMnemonic("LD L, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->L.setValue(this->E.getValue());
-		PC++;
-		instructionCaught = true;
+	case FLAGS_LOGIC:
+		this->setFlags(result == 0, false, false, carry);
 		break;
-		// LD L, H Length: 1 Cycles 4 Opcode: 0x6C Flags: ----
-	case (uint8_t)0x6C: instruction.setMnemonic("LD L, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->L.setValue(this->H.getValue());
-		PC++;
-		instructionCaught = true;
+	case FLAGS_INC:
+		this->setFlags(result == 0, false, (result & 0xF) == 0x0, carry);
 		break;
-		// LD L, L Length: 1 Cycles 4 Opcode: 0x6D Flags: ----
-	case (uint8_t)0x6D: instruction.setMnemonic("LD L, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->L.setValue(this->L.getValue());
-		PC++;
-		instructionCaught = true;
+	case FLAGS_DEC:
+		this->setFlags(result == 0, true, (result & 0xF) == 0xF, carry);
 		break;
-		// LD L, (HL) Length: 1 Cycles 8 Opcode: 0x6E Flags: ----
-	case (uint8_t)0x6E: instruction.setMnemonic("LD L, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = this->H.getValue() << 8 | (this->L.getValue() & 0xFF);
-		this->L.setValue(this->memory->read(addr));
-		PC++;
-		instructionCaught = true;
+	default:
 		break;
-		// LD L, A Length: 1 Cycles 4 Opcode: 0x6F Flags: ----
-	case (uint8_t)0x6F: instruction.setMnemonic("LD L, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->L.setValue(this->A.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD (HL), B Length: 1 Cycles 8 Opcode: 0x70 Flags: ----
-	case (uint8_t)0x70: instruction.setMnemonic("LD (HL), B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = this->H.getValue() << 8 | (this->L.getValue() & 0xFF);
-		this->memory->write(addr, this->A.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD (HL), C Length: 1 Cycles 8 Opcode: 0x71 Flags: ----
-	case (uint8_t)0x71: instruction.setMnemonic("LD (HL), C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = this->H.getValue() << 8 | (this->L.getValue() & 0xFF);
-		this->memory->write(addr, this->C.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD (HL), D Length: 1 Cycles 8 Opcode: 0x71 Flags: ----
-	case (uint8_t)0x72: instruction.setMnemonic("LD (HL), D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = this->H.getValue() << 8 | (this->L.getValue() & 0xFF);
-		this->memory->write(addr, this->D.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD (HL), E Length: 1 Cycles 8 Opcode: 0x73 Flags: ----
-	case (uint8_t)0x73: instruction.setMnemonic("LD (HL), E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = this->H.getValue() << 8 | (this->L.getValue() & 0xFF);
-		this->memory->write(addr, this->E.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD (HL), H Length: 1 Cycles 8 Opcode: 0x74 Flags: ----
-	case (uint8_t)0x74: instruction.setMnemonic("LD (HL), H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = this->H.getValue() << 8 | (this->L.getValue() & 0xFF);
-		this->memory->write(addr, this->H.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD (HL), L Length: 1 Cycles 8 Opcode: 0x75 Flags: ----
-	case (uint8_t)0x75: instruction.setMnemonic("LD (HL), L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = this->H.getValue() << 8 | (this->L.getValue() & 0xFF);
-		this->memory->write(addr, this->L.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// HALT Length: 1 Cycles 8 Opcode: 0x76 Flags: ----
-	case (uint8_t)0x76: instruction.setMnemonic("HALT");
-		cout << instruction.getMnemonic() << endl;
-		this->cpuState = HALT;
-		instructionCaught = true;
-		break;
-		// LD (HL), A Length: 1 Cycles 8 Opcode: 0x77 Flags: ----
-	case (uint8_t)0x77: instruction.setMnemonic("LD (HL), A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = this->H.getValue() << 8 | (this->L.getValue() & 0xFF);
-		this->memory->write(addr, this->A.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD A, B Length: 1 Cycles 4 Opcode: 0x78 Flags: ----
-	case (uint8_t)0x78: instruction.setMnemonic("LD A, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->A.setValue(this->B.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD A, C Length: 1 Cycles 4 Opcode: 0x79 Flags: ----
-	case (uint8_t)0x79: instruction.setMnemonic("LD A, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->A.setValue(this->C.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD A, D Length: 1 Cycles 4 Opcode: 0x7A Flags: ----
-	case (uint8_t)0x7A: instruction.setMnemonic("LD A, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->A.setValue(this->D.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD A, E Length: 1 Cycles 4 Opcode: 0x7B Flags: ----
-	case (uint8_t)0x7B: instruction.setMnemonic("LD A, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->A.setValue(this->E.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD A, H Length: 1 Cycles 4 Opcode: 0x7C Flags: ----
-	case (uint8_t)0x7C: instruction.setMnemonic("LD A, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->A.setValue(this->H.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD A, L Length: 1 Cycles 4 Opcode: 0x7D Flags: ----
-	case (uint8_t)0x7D: instruction.setMnemonic("LD A, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->A.setValue(this->L.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD A, (HL) Length: 1 Cycles 8 Opcode: 0x7E Flags: ----
-	case (uint8_t)0x7E: instruction.setMnemonic("LD A, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = this->H.getValue() << 8 | (this->L.getValue() & 0xFF);
-		this->A.setValue(this->memory->read(addr));
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD A, A Length: 1 Cycles 4 Opcode: 0x7F Flags: ----
-	case (uint8_t)0x7F: instruction.setMnemonic("LD A, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->A.setValue(this->A.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// ADD A, B Length: 1 Cycles 4 Opcode: 0x80 Flags: Z0HC
-	case (uint8_t)0x80: instruction.setMnemonic("ADD A, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->B.getValue();
-		//check half carry
-		if (((reg1 & 0xF) + (reg2 & 0xF)) == 0x10)
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) + (reg2 & 0xFF)) == 0x100)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 + reg2;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// ADD A, C Length: 1 Cycles 4 Opcode: 0x81 Flags: Z0HC
-	case (uint8_t)0x81: instruction.setMnemonic("ADD A, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->C.getValue();
-		//check half carry
-		if (((reg1 & 0xF) + (reg2 & 0xF)) == 0x10)
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) + (reg2 & 0xFF)) == 0x100)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 + reg2;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// ADD A, D Length: 1 Cycles 4 Opcode: 0x82 Flags: Z0HC
-	case (uint8_t)0x82: instruction.setMnemonic("ADD A, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->D.getValue();
-		//check half carry
-		if (((reg1 & 0xF) + (reg2 & 0xF)) == 0x10)
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) + (reg2 & 0xFF)) == 0x100)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 + reg2;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// ADD A, E Length: 1 Cycles 4 Opcode: 0x83 Flags: Z0HC
-	case (uint8_t)0x83: instruction.setMnemonic("ADD A, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->E.getValue();
-		//check half carry
-		if (((reg1 & 0xF) + (reg2 & 0xF)) == 0x10)
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) + (reg2 & 0xFF)) == 0x100)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 + reg2;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// ADD A, H Length: 1 Cycles 4 Opcode: 0x84 Flags: Z0HC
-	case (uint8_t)0x84: instruction.setMnemonic("ADD A, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->H.getValue();
-		//check half carry
-		if (((reg1 & 0xF) + (reg2 & 0xF)) == 0x10)
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) + (reg2 & 0xFF)) == 0x100)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 + reg2;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// ADD A, L Length: 1 Cycles 4 Opcode: 0x85 Flags: Z0HC
-	case (uint8_t)0x85: instruction.setMnemonic("ADD A, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->L.getValue();
-		//check half carry
-		if (((reg1 & 0xF) + (reg2 & 0xF)) == 0x10)
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) + (reg2 & 0xFF)) == 0x100)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 + reg2;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// ADD A, (HL) Length: 1 Cycles 4 Opcode: 0x86 Flags: Z0HC
-	case (uint8_t)0x86: instruction.setMnemonic("ADD A, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->memory->read(this->H.getValue() >> 8 | (this->L.getValue() & 0x00FF));
-		//check half carry
-		if (((reg1 & 0xF) + (reg2 & 0xF)) == 0x10)
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) + (reg2 & 0xFF)) == 0x100)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 + reg2;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// ADD A, A Length: 1 Cycles 4 Opcode: 0x87 Flags: Z0HC
-	case (uint8_t)0x87: instruction.setMnemonic("ADD A, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->A.getValue();
-		//check half carry
-		if (((reg1 & 0xF) + (reg2 & 0xF)) == 0x10)
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) + (reg2 & 0xFF)) == 0x100)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 + reg2;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// ADC A, B Length: 1 Cycles 4 Opcode: 0x88 Flags: Z0HC
-	case (uint8_t)0x88: instruction.setMnemonic("ADC A, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->B.getValue();
-		lsb = ((this->F.getValue() & 0b00010000) == 0x10);
-		//check half carry
-		if (((reg1 & 0xF) + (reg2 & 0xF) + (lsb & 0xF)) == 0x10)
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) + (reg2 & 0xFF) + (lsb & 0xFF)) == 0x100)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 + reg2 + lsb;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// ADC A, C Length: 1 Cycles 4 Opcode: 0x89 Flags: Z0HC
-	case (uint8_t)0x89: instruction.setMnemonic("ADC A, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->C.getValue();
-		lsb = ((this->F.getValue() & 0b00010000) == 0x10);
-		//check half carry
-		if (((reg1 & 0xF) + (reg2 & 0xF) + (lsb & 0xF)) == 0x10)
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) + (reg2 & 0xFF) + (lsb & 0xFF)) == 0x100)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 + reg2 + lsb;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// ADC A, D Length: 1 Cycles 4 Opcode: 0x8A Flags: Z0HC
-	case (uint8_t)0x8A: instruction.setMnemonic("ADC A, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->D.getValue();
-		lsb = ((this->F.getValue() & 0b00010000) == 0x10);
-		//check half carry
-		if (((reg1 & 0xF) + (reg2 & 0xF) + (lsb & 0xF)) == 0x10)
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) + (reg2 & 0xFF) + (lsb & 0xFF)) == 0x100)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 + reg2 + lsb;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// ADC A, E Length: 1 Cycles 4 Opcode: 0x8B Flags: Z0HC
-	case (uint8_t)0x8B: instruction.setMnemonic("ADC A, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->E.getValue();
-		lsb = ((this->F.getValue() & 0b00010000) == 0x10);
-		//check half carry
-		if (((reg1 & 0xF) + (reg2 & 0xF) + (lsb & 0xF)) == 0x10)
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) + (reg2 & 0xFF) + (lsb & 0xFF)) == 0x100)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 + reg2 + lsb;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// ADC A, H Length: 1 Cycles 4 Opcode: 0x8C Flags: Z0HC
-	case (uint8_t)0x8C: instruction.setMnemonic("ADC A, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->H.getValue();
-		lsb = ((this->F.getValue() & 0b00010000) == 0x10);
-		//check half carry
-		if (((reg1 & 0xF) + (reg2 & 0xF) + (lsb & 0xF)) == 0x10)
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) + (reg2 & 0xFF) + (lsb & 0xFF)) == 0x100)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 + reg2 + lsb;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// ADC A, L Length: 1 Cycles 4 Opcode: 0x8D Flags: Z0HC
-	case (uint8_t)0x8D: instruction.setMnemonic("ADC A, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->L.getValue();
-		lsb = ((this->F.getValue() & 0b00010000) == 0x10);
-		//check half carry
-		if (((reg1 & 0xF) + (reg2 & 0xF) + (lsb & 0xF)) == 0x10)
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) + (reg2 & 0xFF) + (lsb & 0xFF)) == 0x100)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 + reg2 + lsb;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// ADC A, (HL) Length: 1 Cycles 8 Opcode: 0x8E Flags: Z0HC
-	case (uint8_t)0x8E: instruction.setMnemonic("ADC A, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->H.getValue() >> 8 | (this->L.getValue() & 0xFF);
-		lsb = ((this->F.getValue() & 0b00010000) == 0x10);
-		//check half carry
-		if (((reg1 & 0xF) + (reg2 & 0xF) + (lsb & 0xF)) == 0x10)
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) + (reg2 & 0xFF) + (lsb & 0xFF)) == 0x100)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 + reg2 + lsb;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// ADC A, A Length: 1 Cycles 4 Opcode: 0x8F Flags: Z0HC
-	case (uint8_t)0x8F: instruction.setMnemonic("ADC A, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->A.getValue();
-		lsb = ((this->F.getValue() & 0b00010000) == 0x10);
-		//check half carry
-		if (((reg1 & 0xF) + (reg2 & 0xF) + (lsb & 0xF)) == 0x10)
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) + (reg2 & 0xFF) + (lsb & 0xFF)) == 0x100)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 + reg2 + lsb;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SUB B Length: 1 Cycles 4 Opcode: 0x90 Flags: Z1HC
-	case (uint8_t)0x90: instruction.setMnemonic("SUB B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->B.getValue();
-		//check half carry for borrow
-		if ((reg1 & 0xF) - (reg2 & 0xF) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - (reg2 & 0xFF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 - reg2;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SUB C Length: 1 Cycles 4 Opcode: 0x91 Flags: Z1HC
-	case (uint8_t)0x91: instruction.setMnemonic("SUB C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->C.getValue();
-		//check half carry for borrow
-		if ((reg1 & 0xF) - (reg2 & 0xF) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - (reg2 & 0xFF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 - reg2;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SUB D Length: 1 Cycles 4 Opcode: 0x92 Flags: Z1HC
-	case (uint8_t)0x92: instruction.setMnemonic("SUB D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->D.getValue();
-		//check half carry for borrow
-		if ((reg1 & 0xF) - (reg2 & 0xF) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - (reg2 & 0xFF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 - reg2;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SUB E Length: 1 Cycles 4 Opcode: 0x93 Flags: Z1HC
-	case (uint8_t)0x93: instruction.setMnemonic("SUB E");//DONE
-		reg1 = this->A.getValue(), reg2 = this->E.getValue();
-		//check half carry for borrow
-		if ((reg1 & 0xF) - (reg2 & 0xF) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - (reg2 & 0xFF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 - reg2;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		cout << instruction.getMnemonic() << endl;
-		instructionCaught = true;
-		break;
-		// SUB H Length: 1 Cycles 4 Opcode: 0x94 Flags: Z1HC
-	case (uint8_t)0x94: instruction.setMnemonic("SUB H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->H.getValue();
-		//check half carry for borrow
-		if ((reg1 & 0xF) - (reg2 & 0xF) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - (reg2 & 0xFF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 - reg2;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SUB L Length: 1 Cycles 4 Opcode: 0x95 Flags: Z1HC
-	case (uint8_t)0x95: instruction.setMnemonic("SUB L");//DONE
-		reg1 = this->A.getValue(), reg2 = this->L.getValue();
-		//check half carry for borrow
-		if ((reg1 & 0xF) - (reg2 & 0xF) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - (reg2 & 0xFF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 - reg2;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		cout << instruction.getMnemonic() << endl;
-		instructionCaught = true;
-		break;
-		// SUB (HL) Length: 1 Cycles 8 Opcode: 0x96 Flags: Z1HC
-	case (uint8_t)0x96: instruction.setMnemonic("SUB (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->memory->read((this->H.getValue() >> 8) | (this->L.getValue() & 0xFF));
-		//check half carry for borrow
-		if ((reg1 & 0xF) - (reg2 & 0xF) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - (reg2 & 0xFF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 - reg2;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SUB A Length: 1 Cycles 4 Opcode: 0x97 Flags: Z1HC
-	case (uint8_t)0x97: instruction.setMnemonic("SUB A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->A.getValue();
-		//check half carry for borrow
-		if ((reg1 & 0xF) - (reg2 & 0xF) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - (reg2 & 0xFF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 - reg2;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SBC A, B Length: 1 Cycles 4 Opcode: 0x98 Flags: Z1HC
-	case (uint8_t)0x98: instruction.setMnemonic("SBC A, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->B.getValue();
-		lsb = (this->F.getValue() & 0b00010000 == 0x10);
-		//check half carry for borrow
-		if ((reg1 & 0xF) - ((reg2 & 0xF) + (lsb & 0xF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - ((reg2 & 0xFF) + (lsb & 0xFF)) < 0))
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 - reg2 - lsb;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SBC A, C Length: 1 Cycles 4 Opcode: 0x99 Flags: Z1HC
-	case (uint8_t)0x99: instruction.setMnemonic("SBC A, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->C.getValue();
-		lsb = (this->F.getValue() & 0b00010000 == 0x10);
-		//check half carry for borrow
-		if ((reg1 & 0xF) - ((reg2 & 0xF) + (lsb & 0xF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - ((reg2 & 0xFF) + (lsb & 0xFF)) < 0))
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 - reg2 - lsb;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SBC A, D Length: 1 Cycles 4 Opcode: 0x9A Flags: Z1HC
-	case (uint8_t)0x9A: instruction.setMnemonic("SBC A, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->D.getValue();
-		lsb = ((this->F.getValue() & 0b00010000) == 0x10);
-		//check half carry for borrow
-		if ((reg1 & 0xF) - ((reg2 & 0xF) + (lsb & 0xF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - ((reg2 & 0xFF) + (lsb & 0xFF)) < 0))
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 - reg2 - lsb;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SBC A, E Length: 1 Cycles 4 Opcode: 0x9B Flags: Z1HC
-	case (uint8_t)0x9B: instruction.setMnemonic("SBC A, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->E.getValue();
-		lsb = (this->F.getValue() & 0b00010000 == 0x10);
-		//check half carry for borrow
-		if ((reg1 & 0xF) - ((reg2 & 0xF) + (lsb & 0xF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - ((reg2 & 0xFF) + (lsb & 0xFF)) < 0))
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 - reg2 - lsb;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SBC A, H Length: 1 Cycles 4 Opcode: 0x9C Flags: Z1HC
-	case (uint8_t)0x9C: instruction.setMnemonic("SBC A, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->H.getValue();
-		lsb = (this->F.getValue() & 0b00010000 == 0x10);
-		//check half carry for borrow
-		if ((reg1 & 0xF) - ((reg2 & 0xF) + (lsb & 0xF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - ((reg2 & 0xFF) + (lsb & 0xFF)) < 0))
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 - reg2 - lsb;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SBC A, L Length: 1 Cycles 4 Opcode: 0x9D Flags: Z1HC
-	case (uint8_t)0x9D: instruction.setMnemonic("SBC A, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->L.getValue();
-		lsb = (this->F.getValue() & 0b00010000 == 0x10);
-		//check half carry for borrow
-		if ((reg1 & 0xF) - ((reg2 & 0xF) + (lsb & 0xF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - ((reg2 & 0xFF) + (lsb & 0xFF)) < 0))
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 - reg2 - lsb;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SBC A, (HL) Length: 1 Cycles 8 Opcode: 0x9E Flags: Z1HC
-	case (uint8_t)0x9E: instruction.setMnemonic("SBC A, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->memory->read((this->H.getValue() >> 8) | (this->L.getValue() & 0xFF));
-		lsb = (this->F.getValue() & 0b00010000 == 0x10);
-		//check half carry for borrow
-		if ((reg1 & 0xF) - ((reg2 & 0xF) + (lsb & 0xF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - ((reg2 & 0xFF) + (lsb & 0xFF)) < 0))
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 - reg2 - lsb;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SBC A, A Length: 1 Cycles 4 Opcode: 0x9F Flags: Z1HC
-	case (uint8_t)0x9F: instruction.setMnemonic("SBC A, A");//DONE
-		reg1 = this->A.getValue(), reg2 = this->A.getValue();
-		lsb = (this->F.getValue() & 0b00010000 == 0x10);
-		//check half carry for borrow
-		if ((reg1 & 0xF) - ((reg2 & 0xF) + (lsb & 0xF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - ((reg2 & 0xFF) + (lsb & 0xFF)) < 0))
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 - reg2 - lsb;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		cout << instruction.getMnemonic() << endl;
-		instructionCaught = true;
-		break;
-		// AND B Length: 1 Cycles 4 Opcode: 0xA0 Flags: Z010
-	case (uint8_t)0xA0: instruction.setMnemonic("AND B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->B.getValue();
-		result = reg1 & reg2;
-		this->A.setValue(result);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		this->F.setValue(this->F.getValue() & 0b10100000);
-		this->F.setValue(this->F.getValue() & 0b00100000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// AND C Length: 1 Cycles 4 Opcode: 0xA1 Flags: Z010
-	case (uint8_t)0xA1: instruction.setMnemonic("AND C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->C.getValue();
-		result = reg1 & reg2;
-		this->A.setValue(result);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		this->F.setValue(this->F.getValue() & 0b10100000);
-		this->F.setValue(this->F.getValue() & 0b00100000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// AND D Length: 1 Cycles 4 Opcode: 0xA2 Flags: Z010
-	case (uint8_t)0xA2: instruction.setMnemonic("AND D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->D.getValue();
-		result = reg1 & reg2;
-		this->A.setValue(result);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		this->F.setValue(this->F.getValue() & 0b10100000);
-		this->F.setValue(this->F.getValue() & 0b00100000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// AND E Length: 1 Cycles 4 Opcode: 0xA3 Flags: Z010
-	case (uint8_t)0xA3: instruction.setMnemonic("AND E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->E.getValue();
-		result = reg1 & reg2;
-		this->A.setValue(result);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		this->F.setValue(this->F.getValue() & 0b10100000);
-		this->F.setValue(this->F.getValue() & 0b00100000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// AND H Length: 1 Cycles 4 Opcode: 0xA4 Flags: Z010
-	case (uint8_t)0xA4: instruction.setMnemonic("AND H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->H.getValue();
-		result = reg1 & reg2;
-		this->A.setValue(result);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		this->F.setValue(this->F.getValue() & 0b10100000);
-		this->F.setValue(this->F.getValue() & 0b00100000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// AND L Length: 1 Cycles 4 Opcode: 0xA5 Flags: Z010
-	case (uint8_t)0xA5: instruction.setMnemonic("AND L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->L.getValue();
-		result = reg1 & reg2;
-		this->A.setValue(result);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		this->F.setValue(this->F.getValue() & 0b10100000);
-		this->F.setValue(this->F.getValue() & 0b00100000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// AND (HL) Length: 1 Cycles 8 Opcode: 0xA0 Flags: Z010
-	case (uint8_t)0xA6: instruction.setMnemonic("AND (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->memory->read((this->H.getValue() >> 8) | (this->L.getValue() & 0xFF));
-		result = reg1 & reg2;
-		this->A.setValue(result);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		this->F.setValue(this->F.getValue() & 0b10100000);
-		this->F.setValue(this->F.getValue() & 0b00100000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// AND A Length: 1 Cycles 4 Opcode: 0xA7 Flags: Z010
-	case (uint8_t)0xA7: instruction.setMnemonic("AND A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->A.getValue();
-		result = reg1 & reg2;
-		this->A.setValue(result);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		this->F.setValue(this->F.getValue() & 0b10100000);
-		this->F.setValue(this->F.getValue() & 0b00100000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// XOR B Length: 1 Cycles 4 Opcode: 0xA8 Flags: Z000
-	case (uint8_t)0xA8: instruction.setMnemonic("XOR B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->B.getValue();
-		result = reg1 ^ reg2;
-		this->A.setValue(result);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		this->F.setValue(this->F.getValue() & 0b10000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// XOR C Length: 1 Cycles 4 Opcode: 0xA9 Flags: Z000
-	case (uint8_t)0xA9: instruction.setMnemonic("XOR C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->C.getValue();
-		result = reg1 ^ reg2;
-		this->A.setValue(result);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		this->F.setValue(this->F.getValue() & 0b10000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// XOR D Length: 1 Cycles 4 Opcode: 0xAA Flags: Z000
-	case (uint8_t)0xAA: instruction.setMnemonic("XOR D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->D.getValue();
-		result = reg1 ^ reg2;
-		this->A.setValue(result);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		this->F.setValue(this->F.getValue() & 0b10000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// XOR E Length: 1 Cycles 4 Opcode: 0xAB Flags: Z000
-	case (uint8_t)0xAB: instruction.setMnemonic("XOR E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->E.getValue();
-		result = reg1 ^ reg2;
-		this->A.setValue(result);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		this->F.setValue(this->F.getValue() & 0b10000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// XOR H Length: 1 Cycles 4 Opcode: 0xAC Flags: Z000
-	case (uint8_t)0xAC: instruction.setMnemonic("XOR H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->H.getValue();
-		result = reg1 ^ reg2;
-		this->A.setValue(result);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		this->F.setValue(this->F.getValue() & 0b10000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// XOR L Length: 1 Cycles 4 Opcode: 0xAD Flags: Z000
-	case (uint8_t)0xAD: instruction.setMnemonic("XOR L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->L.getValue();
-		result = reg1 ^ reg2;
-		this->A.setValue(result);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		this->F.setValue(this->F.getValue() & 0b10000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// XOR (HL) Length: 1 Cycles 8 Opcode: 0xAE Flags: Z000
-	case (uint8_t)0xAE: instruction.setMnemonic("XOR (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->memory->read((this->H.getValue() >> 8) | (this->L.getValue() & 0xFF));
-		result = reg1 ^ reg2;
-		this->A.setValue(result);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		this->F.setValue(this->F.getValue() & 0b10000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// XOR A Length: 1 Cycles 4 Opcode: 0xAF Flags: Z000
-	case (uint8_t)0xAF: instruction.setMnemonic("XOR A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->A.getValue();
-		result = reg1 ^ reg2;
-		this->A.setValue(result);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		this->F.setValue(this->F.getValue() & 0b10000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// OR B Length: 1 Cycles 4 Opcode: 0xB0 Flags: Z000
-	case (uint8_t)0xB0: instruction.setMnemonic("OR B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->B.getValue();
-		result = reg1 | reg2;
-		this->A.setValue(result);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		this->F.setValue(this->F.getValue() & 0b10000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// OR C Length: 1 Cycles 4 Opcode: 0xB1 Flags: Z000
-	case (uint8_t)0xB1: instruction.setMnemonic("OR C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->C.getValue();
-		result = reg1 | reg2;
-		this->A.setValue(result);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		this->F.setValue(this->F.getValue() & 0b10000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// OR D Length: 1 Cycles 4 Opcode: 0xB2 Flags: Z000
-	case (uint8_t)0xB2: instruction.setMnemonic("OR D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->D.getValue();
-		result = reg1 | reg2;
-		this->A.setValue(result);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		this->F.setValue(this->F.getValue() & 0b10000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// OR E Length: 1 Cycles 4 Opcode: 0xB3 Flags: Z000
-	case (uint8_t)0xB3: instruction.setMnemonic("OR E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->E.getValue();
-		result = reg1 | reg2;
-		this->A.setValue(result);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		this->F.setValue(this->F.getValue() & 0b10000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// OR H Length: 1 Cycles 4 Opcode: 0xB4 Flags: Z000
-	case (uint8_t)0xB4: instruction.setMnemonic("OR H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->H.getValue();
-		result = reg1 | reg2;
-		this->A.setValue(result);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		this->F.setValue(this->F.getValue() & 0b10000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// OR L Length: 1 Cycles 4 Opcode: 0xB5 Flags: Z000
-	case (uint8_t)0xB5: instruction.setMnemonic("OR L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->L.getValue();
-		result = reg1 | reg2;
-		this->A.setValue(result);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		this->F.setValue(this->F.getValue() & 0b10000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// OR (HL) Length: 1 Cycles 8 Opcode: 0xB6 Flags: Z000
-	case (uint8_t)0xB6: instruction.setMnemonic("OR (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->memory->read((this->H.getValue() >> 8) | (this->L.getValue() & 0xFF));
-		result = reg1 | reg2;
-		this->A.setValue(result);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		this->F.setValue(this->F.getValue() & 0b10000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// OR A Length: 1 Cycles 4 Opcode: 0xB7 Flags: Z000
-	case (uint8_t)0xB7: instruction.setMnemonic("OR A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->A.getValue();
-		result = reg1 | reg2;
-		this->A.setValue(result);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		this->F.setValue(this->F.getValue() & 0b10000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// CP B Length: 1 Cycles 4 Opcode: 0xB8 Flags: Z1HC
-	case (uint8_t)0xB8: instruction.setMnemonic("CP B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->B.getValue();
-		//check half carry for borrow
-		if ((reg1 & 0xF) - (reg2 & 0xF) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - (reg2 & 0xFF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}		
-		//check zero
-		if (reg1 == reg2)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// CP C Length: 1 Cycles 4 Opcode: 0xB9 Flags: Z1HC
-	case (uint8_t)0xB9: instruction.setMnemonic("CP C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->C.getValue();
-		//check half carry for borrow
-		if ((reg1 & 0xF) - (reg2 & 0xF) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - (reg2 & 0xFF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//check zero
-		if (reg1 == reg2)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// CP D Length: 1 Cycles 4 Opcode: 0xB8 Flags: Z1HC
-	case (uint8_t)0xBA: instruction.setMnemonic("CP D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->D.getValue();
-		//check half carry for borrow
-		if ((reg1 & 0xF) - (reg2 & 0xF) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - (reg2 & 0xFF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//check zero
-		if (reg1 == reg2)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// CP E Length: 1 Cycles 4 Opcode: 0xBB Flags: Z1HC
-	case (uint8_t)0xBB: instruction.setMnemonic("CP E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->E.getValue();
-		//check half carry for borrow
-		if ((reg1 & 0xF) - (reg2 & 0xF) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - (reg2 & 0xFF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//check zero
-		if (reg1 == reg2)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// CP H Length: 1 Cycles 4 Opcode: 0xBC Flags: Z1HC
-	case (uint8_t)0xBC: instruction.setMnemonic("CP H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->H.getValue();
-		//check half carry for borrow
-		if ((reg1 & 0xF) - (reg2 & 0xF) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - (reg2 & 0xFF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//check zero
-		if (reg1 == reg2)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// CP L Length: 1 Cycles 4 Opcode: 0xBD Flags: Z1HC
-	case (uint8_t)0xBD: instruction.setMnemonic("CP L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->L.getValue();
-		//check half carry for borrow
-		if ((reg1 & 0xF) - (reg2 & 0xF) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - (reg2 & 0xFF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//check zero
-		if (reg1 == reg2)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// CP (HL) Length: 1 Cycles 8 Opcode: 0xBE Flags: Z1HC
-	case (uint8_t)0xBE: instruction.setMnemonic("CP (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->memory->read((this->H.getValue() >> 8) | (this->L.getValue() & 0xFF));
-		//check half carry for borrow
-		if ((reg1 & 0xF) - (reg2 & 0xF) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - (reg2 & 0xFF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//check zero
-		if (reg1 == reg2)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// CP A Length: 1 Cycles 4 Opcode: 0xBF Flags: Z1HC
-	case (uint8_t)0xBF: instruction.setMnemonic("CP A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue(), reg2 = this->A.getValue();
-		//check half carry for borrow
-		if ((reg1 & 0xF) - (reg2 & 0xF) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - (reg2 & 0xFF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//check zero
-		if (reg1 == reg2)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RET NZ Length: 1 Cycles 20/8 Opcode: 0xC0 Flags: ----
-	case (uint8_t)0xC0: instruction.setMnemonic("RET NZ");//DONE
-		cout << instruction.getMnemonic() << endl;
-		instructionCaught = true;
-		if ((this->F.getValue() & 0x80) == 0x00)
-		{
-			PC = ((this->memory->read(stackPointer + 1) >> 8) & 0xFF00) | (this->memory->read(stackPointer) & 0x00FF);
-			stackPointer += 2;
-		}
-		else
-		{
-			PC++;
-		}
-		break;
-		// POP BC Length: 1 Cycles 12 Opcode: 0xC1 Flags: ----
-	case (uint8_t)0xC1: instruction.setMnemonic("POP BC");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg116 = ((this->memory->read(stackPointer + 1) >> 8) & 0xFF00) | (this->memory->read(stackPointer) & 0x00FF);
-		this->B.setValue((reg116 & 0xFF00) << 8);
-		this->C.setValue(reg116 & 0x00FF);
-		stackPointer += 2;
-		PC++;
-		instructionCaught = true;
-		break;
-		// JP NZ, a16 Length: 3 Cycles 16/12 Opcode: 0xC2 Flags: ----
-	case (uint8_t)0xC2: instruction.setMnemonic("JP NZ, a16");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		if ((this->F.getValue() & 0x80) == 0x00)
-		{
-			PC = (((this->memory->read(PC + 1)) >> 8) & 0xFF00 | ((PC) & 0x00FF));
-		}
-		else
-		{
-			PC += 2;
-		}
-		instructionCaught = true;
-		break;
-		// JP a16 Length: 3 Cycles 16 Opcode: 0xC3 Flags: ----
-	case (uint8_t)0xC3: instruction.setMnemonic("JP a16");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		PC = (((this->memory->read(PC + 1)) >> 8) & 0xFF00 | ((PC) & 0x00FF));
-		instructionCaught = true;
-		break;
-		// CALL NZ, a16 Length: 3 Cycles 24/12 Opcode: 0xC4 Flags: ----
-	case (uint8_t)0xC4: instruction.setMnemonic("CALL NZ, a16");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		if ((this->F.getValue() & 0x80) == 0x00)
-		{
-			//push return address to stack
-			stackPointer--;
-			this->memory->write(stackPointer, (PC & 0xFF00) << 8);
-			stackPointer--;
-			this->memory->write(stackPointer, (PC & 0x00FF));
-			//jump to called function
-			PC = (((this->memory->read(PC)) >> 8) & 0xFF00 | ((PC + 1) & 0x00FF));
-		}
-		else
-		{
-			PC += 2;
-		}
-		instructionCaught = true;
-		break;
-		// PUSH BC Length: 1 Cycles 16 Opcode: 0xC5 Flags: ----
-	case (uint8_t)0xC5: instruction.setMnemonic("PUSH BC");//DONE
-		cout << instruction.getMnemonic() << endl;
-		stackPointer--;
-		this->memory->write(stackPointer, this->B.getValue());
-		stackPointer--;
-		this->memory->write(stackPointer, this->C.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// ADD A, d8 Length: 2 Cycles 8 Opcode: 0xC6 Flags: Z0HC
-	case (uint8_t)0xC6: instruction.setMnemonic("ADD A, d8");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		reg1 = this->A.getValue(), reg2 = this->memory->read(PC);
-		//check half carry
-		if (((reg1 & 0xF) + (reg2 & 0xF)) == 0x10)
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) + (reg2 & 0xFF)) == 0x100)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 + reg2;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RST 00H Length: 1 Cycles 16 Opcode: 0xC7 Flags: ----
-	case (uint8_t)0xC7: instruction.setMnemonic("RST 00H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//push PC onto Stack
-		reg116 = PC + 1;
-		stackPointer--;
-		this->memory->write(stackPointer, (reg116 & 0xFF00) << 8);
-		stackPointer--;
-		this->memory->write(stackPointer, (reg116 & 0x00FF));
-		PC = 0x0000;
-		instructionCaught = true;
-		break;
-		// RET Z Length: 1 Cycles 20/8 Opcode: 0xC8 Flags: ----
-	case (uint8_t)0xC8: instruction.setMnemonic("RET Z");//DONE
-		cout << instruction.getMnemonic() << endl;
-		if (this->F.getValue() & 0x80 == 0x80)
-		{
-			//pop address from stack
-			PC = ((this->memory->read(stackPointer + 1) & 0xFF00) >> 8) | (this->memory->read(stackPointer) & 0x00FF);
-			stackPointer += 2;
-		}
-		else
-			PC++;
-		instructionCaught = true;
-		break;
-		// RET Length: 1 Cycles 16 Opcode: 0xC9 Flags: ----
-	case (uint8_t)0xC9: instruction.setMnemonic("RET");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//pop address from stack
-		PC = ((this->memory->read(stackPointer + 1) & 0xFF00) >> 8) | (this->memory->read(stackPointer) & 0x00FF);
-		stackPointer += 2;
-		instructionCaught = true;
-		break;
-		// JP Z, a16 Length: 3 Cycles 16/12 Opcode: 0xCA Flags: ----
-	case (uint8_t)0xCA: instruction.setMnemonic("JP Z, a16");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		if (this->F.getValue() & 0x80 == 0x80)
-		{
-			PC = ((this->memory->read(PC + 1) & 0xFF00) >> 8) | (this->memory->read(PC) & 0x00FF);
-		}
-		else
-			PC += 2;
-		instructionCaught = true;
-		break;
-		// PREFIX CB Length: 1 Cycles 4 Opcode: 0xCB Flags: ----
-	case (uint8_t)0xCB: instruction.setMnemonic("PREFIX CB");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		instructionPrefix.setOpCode(nextOpCode);
-		instructionCaught = executeCBPrefixInstruction(instructionPrefix, PC, memory, cyclesLeft);
-		break;
-		// CALL Z, a16 Length: 3 Cycles 16/12 Opcode: 0xCC Flags: ----
-	case (uint8_t)0xCC: instruction.setMnemonic("CALL Z, a16");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		if ((this->F.getValue() & 0x80) == 0x80)
-		{
-			//push return address to stack
-			stackPointer--;
-			this->memory->write(stackPointer, (PC & 0xFF00) << 8);
-			stackPointer--;
-			this->memory->write(stackPointer, (PC & 0x00FF));
-			//jump to called function
-			PC = (((this->memory->read(PC + 1)) >> 8) & 0xFF00 | ((PC) & 0x00FF));
-		}
-		else
-		{
-			PC += 2;
-		}
-		instructionCaught = true;
-		break;
-		// CALL a16 Length: 3 Cycles 16/12 Opcode: 0xCD Flags: ----
-	case (uint8_t)0xCD: instruction.setMnemonic("CALL a16");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		//push return address to stack
-		stackPointer--;
-		this->memory->write(stackPointer, (PC & 0xFF00) << 8);
-		stackPointer--;
-		this->memory->write(stackPointer, (PC & 0x00FF));
-		//jump to called function
-		PC = (((this->memory->read(PC + 1)) >> 8) & 0xFF00 | ((PC) & 0x00FF));
-		instructionCaught = true;
-		break;
-		// ADC A, d8 Length: 2 Cycles 8 Opcode: 0xCE Flags: Z0HC
-	case (uint8_t)0xCE: instruction.setMnemonic("ADC A, d8");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		reg1 = this->A.getValue(), reg2 = this->memory->read(PC);
-		lsb = ((this->F.getValue() & 0b00010000) == 0x10);
-		//check half carry
-		if (((reg1 & 0xF) + (reg2 & 0xF) + (lsb & 0xF)) == 0x10)
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) + (reg2 & 0xFF) + (lsb & 0xFF)) == 0x100)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 + reg2 + lsb;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RST 08H Length: 1 Cycles 16 Opcode: 0xCF Flags: ----
-	case (uint8_t)0xCF: instruction.setMnemonic("RST 08H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//push PC onto Stack
-		reg116 = PC + 1;
-		stackPointer--;
-		this->memory->write(stackPointer, (reg116 & 0xFF00) << 8);
-		stackPointer--;
-		this->memory->write(stackPointer, (reg116 & 0x00FF));
-		PC = 0x0008;
-		instructionCaught = true;
-		break;
-		// RET NC Length: 1 Cycles 20/8 Opcode: 0xD0 Flags: ----
-	case (uint8_t)0xD0: instruction.setMnemonic("RET NC");//DONE
-		cout << instruction.getMnemonic() << endl;
-		if ((this->F.getValue() & 0x10) == 0x00)
-		{
-			//pop return address from stack pointer
-			PC = (this->memory->read(stackPointer + 1) >> 8) & 0xFF00 | (this->memory->read(stackPointer) & 0x00FF);
-			//adjust Stack Pointer
-			stackPointer += 2;
-		}
-		else
-		{
-			PC++;
-		}
-		instructionCaught = true;
-		break;
-		// POP DE Length: 1 Cycles 12 Opcode: 0xD1 Flags: ----
-	case (uint8_t)0xD1: instruction.setMnemonic("POP DE");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->E.setValue(this->memory->read(stackPointer));
-		stackPointer++;
-		this->D.setValue(this->memory->read(stackPointer));
-		stackPointer++;
-		PC++;
-		instructionCaught = true;
-		break;
-		// JP NC, a16 Length: 3 Cycles 16/12 Opcode: 0xD2 Flags: ----
-	case (uint8_t)0xD2: instruction.setMnemonic("JP NC, a16");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		if ((this->F.getValue() & 0x10) == 0x00)
-		{
-			//jump
-			PC = (this->memory->read(PC + 1) >> 8) & 0xFF00 | (this->memory->read(PC) & 0x00FF);
-		}
-		else
-		{
-			PC++;
-		}
-		instructionCaught = true;
-		break;
-		// UNUSED
-	case (uint8_t)0xD3:
-		instructionCaught = true;
-		break;
-		// CALL NC, a16 Length: 3 Cycles 24/12 Opcode: 0xD4 Flags: ----
-	case (uint8_t)0xD4: instruction.setMnemonic("CALL NC, a16");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		if ((this->F.getValue() & 0x10) == 0x00)
-		{
-			//push address of next instruction to stack
-			reg116 = PC + 2;
-			stackPointer--;
-			this->memory->write(stackPointer, (reg116 & 0xFF00) >> 8);
-			stackPointer--;
-			this->memory->write(stackPointer, (reg116 & 0x00FF));
-			//Jump to immeadiate address
-			PC = (this->memory->read(PC + 1) >> 8) & 0xFF00 | (this->memory->read(PC) & 0x00FF);
-			
-		}
-		else
-		{
-			PC += 2;
-		}
-		instructionCaught = true;
-		break;
-		// PUSH DE Length: 1 Cycles 16 Opcode: 0xD5 Flags: ----
-	case (uint8_t)0xD5: instruction.setMnemonic("PUSH DE");//DONE
-		cout << instruction.getMnemonic() << endl;
-		stackPointer--;
-		this->memory->write(stackPointer, this->D.getValue());
-		stackPointer--;
-		this->memory->write(stackPointer, this->E.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// SUB d8 Length: 2 Cycles 8 Opcode: 0xD6 Flags: Z1HC
-	case (uint8_t)0xD6: instruction.setMnemonic("SUB d8");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		reg1 = this->A.getValue(), reg2 = this->memory->read(PC);
-		//check half carry for borrow
-		if ((reg1 & 0xF) - (reg2 & 0xF) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - (reg2 & 0xFF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 - reg2;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RST 10H Length: 1 Cycles 16 Opcode: 0xD7 Flags: ----
-	case (uint8_t)0xD7: instruction.setMnemonic("RST 10H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		//push PC onto Stack
-		reg116 = PC + 1;
-		stackPointer--;
-		this->memory->write(stackPointer, (reg116 & 0xFF00) << 8);
-		stackPointer--;
-		this->memory->write(stackPointer, (reg116 & 0x00FF));
-		PC = 0x0010;
-		instructionCaught = true;
-		break;
-		// RET C Length: 1 Cycles 20/8 Opcode: 0xD8 Flags: ----
-	case (uint8_t)0xD8: instruction.setMnemonic("RET C");
-		cout << instruction.getMnemonic() << endl;
-		if ((this->F.getValue() & 0x10) == 0x10)
-		{
-			//pop address of next instruction from stack
-			//Jump to immeadiate address
-			PC = (this->memory->read(stackPointer + 1) >> 8) & 0xFF00 | (this->memory->read(stackPointer) & 0x00FF);
-			stackPointer += 2;
-
-		}
-		else
-		{
-			PC++;
-		}
-		instructionCaught = true;
-		break;
-		// RET I Length: 1 Cycles 16 Opcode: 0xD9 Flags: ----
-	case (uint8_t)0xD9: instruction.setMnemonic("RET I");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->setInteruptStatus(true);
-		PC = (this->memory->read(stackPointer + 1) >> 8) & 0xFF00 | (this->memory->read(stackPointer) & 0x00FF);
-		stackPointer += 2;
-		PC++;
-		instructionCaught = true;
-		break;
-		// JP C, a16 Length: 3 Cycles 16/12 Opcode: 0xDA Flags: ----
-	case (uint8_t)0xDA: instruction.setMnemonic("JP C, a16");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		if ((this->F.getValue() & 0x10) == 0x10)
-		{
-			//Jump to immeadiate address
-			PC = (this->memory->read(PC + 1) >> 8) & 0xFF00 | (this->memory->read(PC) & 0x00FF);
-		}
-		else
-		{
-			PC += 2;
-		}
-		instructionCaught = true;
-		break;
-		// UNUSED
-	case (uint8_t)0xDB:
-		instructionCaught = true;
-		break;
-		// CALL C, a16 Length: 3 Cycles 24/12 Opcode: 0xDC Flags: ----
-	case (uint8_t)0xDC: instruction.setMnemonic("CALL C, a16");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		if ((this->F.getValue() & 0x10) == 0x10)
-		{
-			//push address of the next instructiont to the program counter
-			reg116 = PC + 2;
-			stackPointer--;
-			this->memory->write(stackPointer, (reg116 & 0xFF00) << 8);
-			stackPointer--;
-			this->memory->write(stackPointer, (reg116 & 0x00FF));
-			//Jump to immeadiate address
-			PC = (this->memory->read(PC + 1) >> 8) & 0xFF00 | (this->memory->read(PC) & 0x00FF);
-		}
-		else
-		{
-			PC += 2;
-		}
-		instructionCaught = true;
-		break;
-		// UNUSED
-	case (uint8_t)0xDD:
-		instructionCaught = true;
-		break;
-		// SBC A, d8 Length: 2 Cycles 8 Opcode: 0xDE Flags: Z1HC
-	case (uint8_t)0xDE: instruction.setMnemonic("SBC A, d8");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		reg1 = this->A.getValue(), reg2 = this->memory->read(PC);
-		lsb = (this->F.getValue() & 0b00010000 == 0x10);
-		//check half carry for borrow
-		if ((reg1 & 0xF) - ((reg2 & 0xF) + (lsb & 0xF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - ((reg2 & 0xFF) + (lsb & 0xFF)) < 0))
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//add
-		result = reg1 - reg2 - lsb;
-		//check zero
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RST 18H Length: 1 Cycles 16 Opcode: 0xDF Flags: ----
-	case (uint8_t)0xDF: instruction.setMnemonic("RST 18H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg116 = PC + 1;
-		stackPointer--;
-		this->memory->write(stackPointer, (reg116 & 0xFF00) << 8);
-		stackPointer--;
-		this->memory->write(stackPointer, (reg116 & 0x00FF));
-		PC = 0x0018;
-		instructionCaught = true;
-		break;
-		// LDH (a8), A Length: 2 Cycles 12 Opcode: 0xE0 Flags: ----
-	case (uint8_t)0xE0: instruction.setMnemonic("LDA (a8), A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		reg1 = this->memory->read(PC);
-		this->memory->write((0xFF00 | (reg1 & 0x00FF)), this->A.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// POP HL Length: 1 Cycles 12 Opcode: 0xE1 Flags: ----
-	case (uint8_t)0xE1: instruction.setMnemonic("POP HL");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->L.setValue(this->memory->read(stackPointer));
-		stackPointer++;
-		this->H.setValue(this->memory->read(stackPointer));
-		stackPointer++;
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD (C), A Length: 1 Cycles 8 Opcode: 0xE2 Flags: ----
-	case (uint8_t)0xE2: instruction.setMnemonic("LDA (C), A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->memory->write((0xFF00 | (this->C.getValue() & 0x00FF)), this->A.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// UNUSED
-	case (uint8_t)0xE3:
-		instructionCaught = true;
-		break;
-		// UNUSED
-	case (uint8_t)0xE4:
-		instructionCaught = true;
-		break;
-		// PUSH HL Length: 1 Cycles 16 Opcode: 0xE5 Flags: ----
-	case (uint8_t)0xE5: instruction.setMnemonic("PUSH HL");//DONE
-		cout << instruction.getMnemonic() << endl;
-		stackPointer--;
-		this->memory->write(stackPointer, this->H.getValue());
-		stackPointer--;
-		this->memory->write(stackPointer, this->L.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// AND d8 Length: 2 Cycles 8 Opcode: 0xE6 Flags: Z010
-	case (uint8_t)0xE6: instruction.setMnemonic("AND d8");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		reg1 = this->memory->read(PC);
-		result = this->A.getValue() & reg1;
-		//check flags
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b00000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10100000);
-		//store result
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RST 20H Length: 1 Cycles 16 Opcode: 0xE7 Flags: ----
-	case (uint8_t)0xE7: instruction.setMnemonic("RST 20H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg116 = PC + 1;
-		stackPointer--;
-		this->memory->write(stackPointer, (reg116 & 0xFF00) << 8);
-		stackPointer--;
-		this->memory->write(stackPointer, (reg116 & 0x00FF));
-		PC = 0x0020;
-		instructionCaught = true;
-		break;
-		// ADD SP, r8 Length: 2 Cycles 16 Opcode: 0xE8 Flags: 00HC
-	case (uint8_t)0xE8: instruction.setMnemonic("ADD SP, r8");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		reg1 = this->memory->read(PC);
-		//sign extend immediate
-		if ((reg1 & 0x80) == 0x10)
-		{
-			reg116 = 0xFF00 | (reg1 & 0x00FF);
-		}
-		else
-			reg116 = 0x0000 | (reg1 & 0x00FF);
-		//check half carry
-		if (((stackPointer & 0xFF) + (reg116 & 0xFF)) == 0x100)
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		//Check Carry
-		if (((stackPointer & 0xFFFF) + (reg116 & 0xFFFF)) == 0x10000)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		//Set zero and sub flag
-		this->F.setValue(this->F.getValue() & 0b00110000);
-		//perform addition
-		stackPointer += reg116;
-		PC++;
-		instructionCaught = true;
-		break;
-		// JP (HL) Length: 1 Cycles 4 Opcode: 0xE9 Flags: ----
-	case (uint8_t)0xE9: instruction.setMnemonic("JP (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC = (this->H.getValue() >> 8) & 0xFF00 | (this->L.getValue() & 0x00FF);
-		instructionCaught = true;
-		break;
-		// LD (a16), A Length: 3 Cycles 16 Opcode: 0xEA Flags: ----
-	case (uint8_t)0xEA: instruction.setMnemonic("LD (a16), A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		addr = (this->memory->read(PC + 1) >> 8) & 0xFF00 | (this->memory->read(PC) & 0x00FF);
-		this->memory->write(addr, this->A.getValue());
-		PC += 2;
-		instructionCaught = true;
-		break;
-		// UNUSED
-	case (uint8_t)0xEB:
-		instructionCaught = true;
-		break;
-		// UNUSED
-	case (uint8_t)0xEC:
-		instructionCaught = true;
-		break;
-		// UNUSED
-	case (uint8_t)0xED:
-		instructionCaught = true;
-		break;
-		// XOR d8 Length: 2 Cycles 8 Opcode: 0xEE Flags: Z000
-	case (uint8_t)0xEE: instruction.setMnemonic("XOR d8");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		reg1 = this->memory->read(PC);
-		result = this->A.getValue() ^ reg1;
-		//check flags
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b00000000);
-		this->F.setValue(this->F.getValue() & 0b10000000);
-		//store result
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RST 28H Length: 1 Cycles 16 Opcode: 0xEF Flags: ----
-	case (uint8_t)0xEF: instruction.setMnemonic("RST 28H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg116 = PC + 1;
-		stackPointer--;
-		this->memory->write(stackPointer, (reg116 & 0xFF00) << 8);
-		stackPointer--;
-		this->memory->write(stackPointer, (reg116 & 0x00FF));
-		PC = 0x0028;
-		instructionCaught = true;
-		break;
-		// LDH A, (a8) Length: 2 Cycles 12 Opcode: 0xF0 Flags: ----
-	case (uint8_t)0xF0: instruction.setMnemonic("LDH A, (a8)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		reg1 = this->memory->read(PC);
-		addr = 0xFF00 | (reg1 & 0x00FF);
-		this->A.setValue(this->memory->read(addr));
-		PC++;
-		instructionCaught = true;
-		break;
-		// POP AF Length: 1 Cycles 12 Opcode: 0xF1 Flags: ZNHC
-	case (uint8_t)0xF1: instruction.setMnemonic("POP AF");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->F.setValue(this->memory->read(stackPointer));
-		stackPointer++;
-		this->A.setValue(this->memory->read(stackPointer));
-		stackPointer++;
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD A, (C) Length: 2 Cycles 8 Opcode: 0xF2 Flags: ----
-	case (uint8_t)0xF2: instruction.setMnemonic("LD A, (C)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->C.getValue();
-		addr = 0xFF00 | (reg1 & 0x00FF);
-		this->A.setValue(this->memory->read(addr));
-		PC++;
-		instructionCaught = true;
-		break;
-		// DI Length: 1 Cycles 4 Opcode: 0xF3 Flags: ----
-	case (uint8_t)0xF3: instruction.setMnemonic("DI");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->setInteruptStatus(false);
-		PC++;
-		instructionCaught = true;
-		break;
-		// UNUSED
-	case (uint8_t)0xF4:
-		instructionCaught = true;
-		break;
-		// PUSH AF Length: 1 Cycles 16 Opcode: 0xF5 Flags: ----
-	case (uint8_t)0xF5: instruction.setMnemonic("PUSH AF");//DONE
-		cout << instruction.getMnemonic() << endl;
-		stackPointer--;
-		this->memory->write(stackPointer, this->A.getValue());
-		stackPointer--;
-		this->memory->write(stackPointer, this->F.getValue());
-		PC++;
-		instructionCaught = true;
-		break;
-		// OR d8 Length: 2 Cycles 8 Opcode: 0xF6 Flags: Z000
-	case (uint8_t)0xF6: instruction.setMnemonic("OR d8");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		reg1 = this->memory->read(PC);
-		result = this->A.getValue() | reg1;
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b00000000);
-		this->F.setValue(this->F.getValue() & 0b10000000);
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RST 30H Length: 1 Cycles 16 Opcode: 0xF7 Flags: ----
-	case (uint8_t)0xF7: instruction.setMnemonic("RST 30H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg116 = PC + 1;
-		stackPointer--;
-		this->memory->write(stackPointer, (reg116 & 0xFF00) << 8);
-		stackPointer--;
-		this->memory->write(stackPointer, (reg116 & 0x00FF));
-		PC = 0x0030;
-		instructionCaught = true;
-		break;
-		// LD HL, SP + r8 Length: 2 Cycles 12 Opcode: 0xF8 Flags: 00HC
-	case (uint8_t)0xF8: instruction.setMnemonic("LD HL, PC+r8");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		reg1 = this->memory->read(PC);
-		//sign extend immediate
-		if ((reg1 & 0x80) == 0x10)
-		{
-			reg116 = 0xFF00 | (reg1 & 0x00FF);
-		}
-		else
-			reg116 = 0x0000 | (reg1 & 0x00FF);
-		//check half carry
-		if (((stackPointer & 0xFF) + (reg116 & 0xFF)) == 0x100)
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		//Check Carry
-		if (((stackPointer & 0xFFFF) + (reg116 & 0xFFFF)) == 0x10000)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		//Set zero and sub flag
-		this->F.setValue(this->F.getValue() & 0b00110000);
-		reg216 = stackPointer + reg116;
-		this->H.setValue((reg216 & 0xFF00) << 8);
-		this->L.setValue(reg216 & 0x00FF);
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD SP, HL Length: 1 Cycles 8 Opcode: 0xF9 Flags: ----
-	case (uint8_t)0xF9: instruction.setMnemonic("LD SP, HL");//DONE
-		cout << instruction.getMnemonic() << endl;
-		stackPointer = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		PC++;
-		instructionCaught = true;
-		break;
-		// LD A, (a16) Length: 3 Cycles 16 Opcode: 0xFA Flags: ----
-	case (uint8_t)0xFA: instruction.setMnemonic("LD A, (a16)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		addr = ((this->memory->read(PC + 1) >> 8) & 0xFF00) | (this->memory->read(PC) & 0x00FF);
-		this->A.setValue(this->memory->read(addr));
-		PC += 2;
-		instructionCaught = true;
-		break;
-		// EI Length: 1 Cycles 4 Opcode: 0xFB Flags: ----
-	case (uint8_t)0xFB: instruction.setMnemonic("EI");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->setInteruptStatus(true);
-		PC++;
-		instructionCaught = true;
-		break;
-		// UNUSED
-	case (uint8_t)0xFC:
-		instructionCaught = true;
-		break;
-		// UNUSED
-	case (uint8_t)0xFD:
-		instructionCaught = true;
-		break;
-		// CP d8 Length: 2 Cycles 8 Opcode: 0xFE Flags: Z1HC
-	case (uint8_t)0xFE: instruction.setMnemonic("CP d8");//DONE
-		cout << instruction.getMnemonic() << endl;
-		PC++;
-		reg1 = this->A.getValue(), reg2 = this->memory->read(PC);
-		//check half carry for borrow
-		if ((reg1 & 0xF) - (reg2 & 0xF) < 0)
-		{
-			this->F.setValue(this->F.getValue() & 0b11010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() | 0b00100000);
-		}
-		//check carry
-		if (((reg1 & 0xFF) - (reg2 & 0xFF)) < 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-		{
-			this->F.setValue(this->F.getValue() & 0b11100000);
-		}
-		//check zero
-		if (reg1 == reg2)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b01110000);
-		//set sub flag
-		this->F.setValue(this->F.getValue() | 0b01000000);
-		//store
-		this->A.setValue(result);
-		PC++;
-		PC++;
-		instructionCaught = true;
-		break;
-		//  RST 38H Length: 1 Cycles: 16 Opcode: 0xFF Flags: ----
-	case (uint8_t)0xFF: instruction.setMnemonic("RST 38H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg116 = PC + 1;
-		stackPointer--;
-		this->memory->write(stackPointer, (reg116 & 0xFF00) << 8);
-		stackPointer--;
-		this->memory->write(stackPointer, (reg116 & 0x00FF));
-		PC = 0x0038;
-		instructionCaught = true;
-		break;
-	}
-	if (!instructionCaught)
-	{
-		cout << "instrution unsupported opcode" << endl;
-	}
-	return instructionCaught;
-}
-bool CPU::executeCBPrefixInstruction(Instruction instruction, uint16_t &PC, uint8_t* memory, int &cyclesLeft)
-{
-	bool instructionCaught = false;
-	uint8_t reg1 = 0, reg2 = 0, result = 0, msb = 0, lsb = 0;
-	uint16_t reg116 = 0, reg216 = 0, addr = 0;
-	switch (instruction.getOpCode())
-	{
-		// RLC B Length: 2 Cycles 8 Opcode: 0x00 Flags: Z00C
-	case (uint8_t)0x00: instruction.setMnemonic("RLC B");
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->B.getValue();
-		//set carry flag old bit 7
-		if ((reg1 & 0x80) == 0x80)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b00000000);
-		this->F.setValue(this->F.getValue() & 0b00010000);
-		//rotate
-		PC++;
-		instructionCaught = true;
-		break;
-		// RLC C Length: 2 Cycles 8 Opcode: 0x01 Flags: Z00C
-	case (uint8_t)0x01: instruction.setMnemonic("RLC C");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RLC D Length: 2 Cycles 8 Opcode: 0x02 Flags: Z00C
-	case (uint8_t)0x02: instruction.setMnemonic("RLC D");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RLC E Length: 2 Cycles 8 Opcode: 0x03 Flags: Z00C
-	case (uint8_t)0x03: instruction.setMnemonic("RLC E");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RLC H Length: 2 Cycles 8 Opcode: 0x04 Flags: Z00C
-	case (uint8_t)0x04: instruction.setMnemonic("RLC H");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RLC L Length: 2 Cycles 8 Opcode: 0x05 Flags: Z00C
-	case (uint8_t)0x05: instruction.setMnemonic("RLC L");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RLC (HL) Length: 2 Cycles 16 Opcode: 0x06 Flags: Z00C
-	case (uint8_t)0x06: instruction.setMnemonic("RLC (HL)");
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RLC A Length: 2 Cycles 8 Opcode: 0x07 Flags: Z00C
-	case (uint8_t)0x07: instruction.setMnemonic("RLC A");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RRC B Length: 2 Cycles 8 Opcode: 0x08 Flags: Z00C
-	case (uint8_t)0x08: instruction.setMnemonic("LD (a16), PC");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RRC C Length: 2 Cycles 8 Opcode: 0x09 Flags: Z00C
-	case (uint8_t)0x09: instruction.setMnemonic("RRC C");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RRC D Length: 2 Cycles 8 Opcode: 0x0A Flags: Z00C
-	case (uint8_t)0x0A: instruction.setMnemonic("RRC D");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RRC E Length: 2 Cycles 8 Opcode: 0x0B Flags: Z00C
-	case (uint8_t)0x0B: instruction.setMnemonic("RRC E");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RRC H Length: 2 Cycles 8 Opcode: 0x0C Flags: Z00C
-	case (uint8_t)0x0C: instruction.setMnemonic("RRC H");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RRC L Length: 2 Cycles 8 Opcode: 0x0D Flags: Z00C
-	case (uint8_t)0x0D: instruction.setMnemonic("RRC L");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RRC (HL) Length: 2 Cycles 16 Opcode: 0x0E Flags: Z00C
-	case (uint8_t)0x0E: instruction.setMnemonic("RRC (HL)");
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RRC A Length: 2 Cycles 8 Opcode: 0x0F Flags: Z00C
-	case (uint8_t)0x0F: instruction.setMnemonic("RRC A");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RL B Length: 2 Cycles 8 Opcode: 0x10 Flags: Z00C
-	case (uint8_t)0x10: instruction.setMnemonic("RL B");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RL C Length: 2 Cycles 8 Opcode: 0x11 Flags: Z00C
-	case (uint8_t)0x11: instruction.setMnemonic("RL C");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RL D Length: 2 Cycles 8 Opcode: 0x12 Flags: Z00C
-	case (uint8_t)0x12: instruction.setMnemonic("RL D");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RL E Length: 2 Cycles 8 Opcode: 0x13 Flags: Z00C
-	case (uint8_t)0x13: instruction.setMnemonic("RL E");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RL H Length: 2 Cycles 8 Opcode: 0x14 Flags: Z00C
-	case (uint8_t)0x14: instruction.setMnemonic("RL H");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RL L Length: 2 Cycles 8 Opcode: 0x15 Flags: Z00C
-	case (uint8_t)0x15: instruction.setMnemonic("RL L");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RL (HL) Length: 2 Cycles 16 Opcode: 0x16 Flags: Z00C
-	case (uint8_t)0x16: instruction.setMnemonic("RL (HL)");
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RL A Length: 2 Cycles 8 Opcode: 0x17 Flags: Z00C
-	case (uint8_t)0x17: instruction.setMnemonic("RL A");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RR B Length: 2 Cycles 8 Opcode: 0x18 Flags: Z00C
-	case (uint8_t)0x18: instruction.setMnemonic("RR B");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RR C Length: 2 Cycles 8 Opcode: 0x19 Flags: Z00C
-	case (uint8_t)0x19: instruction.setMnemonic("RR C");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RR D Length: 2 Cycles 8 Opcode: 0x1A Flags: Z00C
-	case (uint8_t)0x1A: instruction.setMnemonic("RR D");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RR E Length: 2 Cycles 8 Opcode: 0x1B Flags: Z00C
-	case (uint8_t)0x1B: instruction.setMnemonic("RR E");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RR H Length: 2 Cycles 8 Opcode: 0x1C Flags: Z00C
-	case (uint8_t)0x1C: instruction.setMnemonic("RR H");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RR L Length: 2 Cycles 8 Opcode: 0x1D Flags: Z00C
-	case (uint8_t)0x1D: instruction.setMnemonic("RR L");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RR (HL) Length: 2 Cycles 8 Opcode: 0x1E Flags: Z00C
-	case (uint8_t)0x1E: instruction.setMnemonic("RR (HL)");
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// RR A Length: 2 Cycles 8 Opcode: 0x1F Flags: Z00C
-	case (uint8_t)0x1F: instruction.setMnemonic("RR A");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// SLA B Length: 2 Cycles 8 Opcode: 0x20 Flags: Z00C
-	case (uint8_t)0x20: instruction.setMnemonic("SLA B");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// SLA C Length: 2 Cycles 8 Opcode: 0x21 Flags: Z00C
-	case (uint8_t)0x21: instruction.setMnemonic("SLA C");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// SLA D Length: 2 Cycles 8 Opcode: 0x22 Flags: Z00C
-	case (uint8_t)0x22: instruction.setMnemonic("SLA D");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// SLA E Length: 2 Cycles 8 Opcode: 0x23 Flags: Z00C
-	case (uint8_t)0x23: instruction.setMnemonic("SLA E");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// SLA H Length: 2 Cycles 8 Opcode: 0x24 Flags: Z00C
-	case (uint8_t)0x24: instruction.setMnemonic("SLA H");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// SLA L Length: 2 Cycles 8 Opcode: 0x25 Flags: Z00C
-	case (uint8_t)0x25: instruction.setMnemonic("SLA L");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// SLA (HL) Length: 2 Cycles 16 Opcode: 0x26 Flags: Z00C
-	case (uint8_t)0x26: instruction.setMnemonic("SLA (HL)");
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// SLA A Length: 2 Cycles 8 Opcode: 0x27 Flags: Z00C
-	case (uint8_t)0x27: instruction.setMnemonic("SLA A");
-		cout << instruction.getMnemonic() << endl;
-		PC = PC + 1;
-		instructionCaught = true;
-		break;
-		// SRA B Length: 2 Cycles 8 Opcode: 0x28 Flags: Z00C
-	case (uint8_t)0x28: instruction.setMnemonic("SRA B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->B.getValue();
-		if ((reg1 & 0x80) == 0x80)
-		{
-			msb = 0x01;
-		}
-		else
-			msb = 0x00;
-		if ((reg1 & 0x01) == 0x01)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b10000000);
-		reg1 = ((reg1 << 1) & 0x7F) | ((msb >> 8) & 0x80);
-		if (reg1 == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b00010000);
-		this->B.setValue(reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SRA C Length: 2 Cycles 8 Opcode: 0x29 Flags: Z00C
-	case (uint8_t)0x29: instruction.setMnemonic("SRA C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->C.getValue();
-		if ((reg1 & 0x80) == 0x80)
-		{
-			msb = 0x01;
-		}
-		else
-			msb = 0x00;
-		if ((reg1 & 0x01) == 0x01)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b10000000);
-		reg1 = ((reg1 << 1) & 0x7F) | ((msb >> 8) & 0x80);
-		if (reg1 == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b00010000);
-		this->C.setValue(reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SRA D Length: 2 Cycles 8 Opcode: 0x2A Flags: Z00C
-	case (uint8_t)0x2A: instruction.setMnemonic("SRA D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->D.getValue();
-		if ((reg1 & 0x80) == 0x80)
-		{
-			msb = 0x01;
-		}
-		else
-			msb = 0x00;
-		if ((reg1 & 0x01) == 0x01)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b10000000);
-		reg1 = ((reg1 << 1) & 0x7F) | ((msb >> 8) & 0x80);
-		if (reg1 == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b00010000);
-		this->D.setValue(reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SRA E Length: 2 Cycles 8 Opcode: 0x2B Flags: Z00C
-	case (uint8_t)0x2B: instruction.setMnemonic("SRA E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->E.getValue();
-		if ((reg1 & 0x80) == 0x80)
-		{
-			msb = 0x01;
-		}
-		else
-			msb = 0x00;
-		if ((reg1 & 0x01) == 0x01)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b10000000);
-		reg1 = ((reg1 << 1) & 0x7F) | ((msb >> 8) & 0x80);
-		if (reg1 == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b00010000);
-		this->E.setValue(reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SRA H Length: 2 Cycles 8 Opcode: 0x2C Flags: Z00C
-	case (uint8_t)0x2C: instruction.setMnemonic("SRA H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->H.getValue();
-		if ((reg1 & 0x80) == 0x80)
-		{
-			msb = 0x01;
-		}
-		else
-			msb = 0x00;
-		if ((reg1 & 0x01) == 0x01)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b10000000);
-		reg1 = ((reg1 << 1) & 0x7F) | ((msb >> 8) & 0x80);
-		if (reg1 == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b00010000);
-		this->H.setValue(reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SRA L Length: 2 Cycles 8 Opcode: 0x2D Flags: Z00C
-	case (uint8_t)0x2D: instruction.setMnemonic("SRA L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->L.getValue();
-		if ((reg1 & 0x80) == 0x80)
-		{
-			msb = 0x01;
-		}
-		else
-			msb = 0x00;
-		if ((reg1 & 0x01) == 0x01)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b10000000);
-		reg1 = ((reg1 << 1) & 0x7F) | ((msb >> 8) & 0x80);
-		if (reg1 == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b00010000);
-		this->L.setValue(reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SRA (HL) Length: 2 Cycles 16 Opcode: 0x2E Flags: Z00C
-	case (uint8_t)0x2E: instruction.setMnemonic("SRA (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		reg1 = this->memory->read(addr);
-		if ((reg1 & 0x80) == 0x80)
-		{
-			msb = 0x01;
-		}
-		else
-			msb = 0x00;
-		if ((reg1 & 0x01) == 0x01)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b10000000);
-		reg1 = ((reg1 << 1) & 0x7F) | ((msb >> 8) & 0x80);
-		if (reg1 == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b00010000);
-		this->memory->write(addr, reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SRA A Length: 2 Cycles 8 Opcode: 0x2F Flags: Z00C
-	case (uint8_t)0x2F: instruction.setMnemonic("SRA A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue();
-		if ((reg1 & 0x80) == 0x80)
-		{
-			msb = 0x01;
-		}
-		else
-			msb = 0x00;
-		if ((reg1 & 0x01) == 0x01)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b10000000);
-		reg1 = ((reg1 << 1) & 0x7F) | ((msb >> 8) & 0x80);
-		if (reg1 == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b00010000);
-		this->A.setValue(reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SWAP B Length: 2 Cycles 8 Opcode: 0x30 Flags: Z000
-	case (uint8_t)0x30: instruction.setMnemonic("SWAP B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->B.getValue & 0x0F;
-		reg2 = this->B.getValue & 0xF0;
-		result = ((reg1 >> 4) & 0xF0) | ((reg2 << 4) & 0x0F);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b00000000);
-		this->F.setValue(this->F.getValue() | 0b10000000);
-		this->B.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SWAP C Length: 2 Cycles 8 Opcode: 0x31 Flags: Z000
-	case (uint8_t)0x31: instruction.setMnemonic("SWAP C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->C.getValue & 0x0F;
-		reg2 = this->C.getValue & 0xF0;
-		result = ((reg1 >> 4) & 0xF0) | ((reg2 << 4) & 0x0F);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b00000000);
-		this->F.setValue(this->F.getValue() | 0b10000000);
-		this->C.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SWAP D Length: 2 Cycles 8 Opcode: 0x32 Flags: Z000
-	case (uint8_t)0x32: instruction.setMnemonic("SWAP D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->D.getValue & 0x0F;
-		reg2 = this->D.getValue & 0xF0;
-		result = ((reg1 >> 4) & 0xF0) | ((reg2 << 4) & 0x0F);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b00000000);
-		this->F.setValue(this->F.getValue() | 0b10000000);
-		this->D.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SWAP E Length: 2 Cycles 8 Opcode: 0x33 Flags: Z000
-	case (uint8_t)0x33: instruction.setMnemonic("SWAP E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->E.getValue & 0x0F;
-		reg2 = this->E.getValue & 0xF0;
-		result = ((reg1 >> 4) & 0xF0) | ((reg2 << 4) & 0x0F);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b00000000);
-		this->F.setValue(this->F.getValue() | 0b10000000);
-		this->E.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SWAP H Length: 2 Cycles 8 Opcode: 0x34 Flags: Z000
-	case (uint8_t)0x34: instruction.setMnemonic("SWAP H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->H.getValue & 0x0F;
-		reg2 = this->H.getValue & 0xF0;
-		result = ((reg1 >> 4) & 0xF0) | ((reg2 << 4) & 0x0F);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b00000000);
-		this->F.setValue(this->F.getValue() | 0b10000000);
-		this->H.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SWAP L Length: 2 Cycles 8 Opcode: 0x35 Flags: Z000
-	case (uint8_t)0x35: instruction.setMnemonic("SWAP L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->L.getValue & 0x0F;
-		reg2 = this->L.getValue & 0xF0;
-		result = ((reg1 >> 4) & 0xF0) | ((reg2 << 4) & 0x0F);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b00000000);
-		this->F.setValue(this->F.getValue() | 0b10000000);
-		this->L.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SWAP (HL) Length: 2 Cycles 16 Opcode: 0x36 Flags: Z000
-	case (uint8_t)0x36: instruction.setMnemonic("SWAP (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		lsb = this->memory->read(addr);
-		reg1 = lsb & 0x0F;
-		reg2 = lsb & 0xF0;
-		result = ((reg1 >> 4) & 0xF0) | ((reg2 << 4) & 0x0F);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b00000000);
-		this->F.setValue(this->F.getValue() | 0b10000000);
-		this->memory->write(addr, result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SWAP A Length: 2 Cycles 8 Opcode: 0x37 Flags: Z000
-	case (uint8_t)0x37: instruction.setMnemonic("SWAP A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue & 0x0F;
-		reg2 = this->A.getValue & 0xF0;
-		result = ((reg1 >> 4) & 0xF0) | ((reg2 << 4) & 0x0F);
-		if (result == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b00000000);
-		this->F.setValue(this->F.getValue() | 0b10000000);
-		this->A.setValue(result);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SRL B Length: 2 Cycles 8 Opcode: 0x38 Flags: Z00C
-	case (uint8_t)0x38: instruction.setMnemonic("SRL B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->B.getValue();
-		if ((reg1 & 0x01) == 0x01)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b10000000);
-		reg1 = (reg1 << 1) & 0x7F;
-		if (reg1 == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b00010000);
-		this->B.setValue(reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SRL C Length: 2 Cycles 8 Opcode: 0x39 Flags: Z00C
-	case (uint8_t)0x39: instruction.setMnemonic("SRL C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->C.getValue();
-		if ((reg1 & 0x01) == 0x01)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b10000000);
-		reg1 = (reg1 << 1) & 0x7F;
-		if (reg1 == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b00010000);
-		this->C.setValue(reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SRL D Length: 2 Cycles 8 Opcode: 0x3A Flags: Z00C
-	case (uint8_t)0x3A: instruction.setMnemonic("SRL D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->D.getValue();
-		if ((reg1 & 0x01) == 0x01)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b10000000);
-		reg1 = (reg1 << 1) & 0x7F;
-		if (reg1 == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b00010000);
-		this->D.setValue(reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SRL E Length: 2 Cycles 8 Opcode: 0x3B Flags: Z00C
-	case (uint8_t)0x3B: instruction.setMnemonic("SRL E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->E.getValue();
-		if ((reg1 & 0x01) == 0x01)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b10000000);
-		reg1 = (reg1 << 1) & 0x7F;
-		if (reg1 == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b00010000);
-		this->E.setValue(reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SRL H Length: 2 Cycles 8 Opcode: 0x3C Flags: Z00C
-	case (uint8_t)0x3C: instruction.setMnemonic("SRL H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->H.getValue();
-		if ((reg1 & 0x01) == 0x01)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b10000000);
-		reg1 = (reg1 << 1) & 0x7F;
-		if (reg1 == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b00010000);
-		this->H.setValue(reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SRL L Length: 2 Cycles 8 Opcode: 0x3D Flags: Z00C
-	case (uint8_t)0x3D: instruction.setMnemonic("SRL L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->L.getValue();
-		if ((reg1 & 0x01) == 0x01)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b10000000);
-		reg1 = (reg1 << 1) & 0x7F;
-		if (reg1 == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b00010000);
-		this->L.setValue(reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SRL (HL) Length: 2 Cycles 16 Opcode: 0x3E Flags: Z00C
-	case (uint8_t)0x3E: instruction.setMnemonic("SRL (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		reg1 = this->memory->read(addr);
-		if ((reg1 & 0x01) == 0x01)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b10000000);
-		reg1 = (reg1 << 1) & 0x7F;
-		if (reg1 == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b00010000);
-		this->memory->write(addr, reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SRL A Length: 2 Cycles 8 Opcode: 0x3F Flags: Z00C
-	case (uint8_t)0x3F: instruction.setMnemonic("SRL A");
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue();
-		if ((reg1 & 0x01) == 0x01)
-		{
-			this->F.setValue(this->F.getValue() | 0b00010000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b10000000);
-		reg1 = (reg1 << 1) & 0x7F;
-		if (reg1 == 0)
-		{
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		}
-		else
-			this->F.setValue(this->F.getValue() & 0b00010000);
-		this->A.setValue(reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 0, B Length: 2 Cycles 8 Opcode: 0x40 Flags: Z01-
-	case (uint8_t)0x40: instruction.setMnemonic("BIT 0, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->B.getValue();
-		if((reg1 & 0x01) == 0x01)
-		{ 
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 0, C Length: 2 Cycles 8 Opcode: 0x41 Flags: Z01-
-	case (uint8_t)0x41: instruction.setMnemonic("BIT 0, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->C.getValue();
-		if ((reg1 & 0x01) == 0x01)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 0, D Length: 2 Cycles 8 Opcode: 0x42 Flags: Z01-
-	case (uint8_t)0x42: instruction.setMnemonic("BIT 0D, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->D.getValue();
-		if ((reg1 & 0x01) == 0x01)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 0, E Length: 2 Cycles 8 Opcode: 0x43 Flags: Z01-
-	case (uint8_t)0x43: instruction.setMnemonic("BIT 0, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->E.getValue();
-		if ((reg1 & 0x01) == 0x01)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 0, H Length: 2 Cycles 8 Opcode: 0x44 Flags: Z01-
-	case (uint8_t)0x44: instruction.setMnemonic("BIT 0, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->H.getValue();
-		if ((reg1 & 0x01) == 0x01)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 0, L Length: 2 Cycles 8 Opcode: 0x45 Flags: Z01-
-	case (uint8_t)0x45: instruction.setMnemonic("BIT 0, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->L.getValue();
-		if ((reg1 & 0x01) == 0x01)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 0, (HL) Length: 2 Cycles 16 Opcode: 0x46 Flags: Z01-
-	case (uint8_t)0x46: instruction.setMnemonic("LD B, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		reg1 = this->memory->read(addr);
-		if ((reg1 & 0x01) == 0x01)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 0, A Length: 2 Cycles 8 Opcode: 0x47 Flags: Z01-
-	case (uint8_t)0x47: instruction.setMnemonic("BIT 0, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue();
-		if ((reg1 & 0x01) == 0x01)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 1, B Length: 2 Cycles 8 Opcode: 0x48 Flags: Z01-
-	case (uint8_t)0x48: instruction.setMnemonic("BIT 1, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->B.getValue();
-		if ((reg1 & 0x02) == 0x02)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 1, C Length: 2 Cycles 8 Opcode: 0x49 Flags: Z01-
-	case (uint8_t)0x49: instruction.setMnemonic("BIT 1, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->C.getValue();
-		if ((reg1 & 0x02) == 0x02)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 1, D Length: 2 Cycles 8 Opcode: 0x4A Flags: Z01-
-	case (uint8_t)0x4A: instruction.setMnemonic("BIT 1, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->D.getValue();
-		if ((reg1 & 0x02) == 0x02)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 1, E Length: 2 Cycles 8 Opcode: 0x4B Flags: Z01-
-	case (uint8_t)0x4B: instruction.setMnemonic("BIT 1, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->E.getValue();
-		if ((reg1 & 0x02) == 0x02)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 1, H Length: 2 Cycles 8 Opcode: 0x4C Flags: Z01-
-	case (uint8_t)0x4C: instruction.setMnemonic("BIT 1, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->H.getValue();
-		if ((reg1 & 0x02) == 0x02)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 1, L Length: 2 Cycles 8 Opcode: 0x4D Flags: Z01-
-	case (uint8_t)0x4D: instruction.setMnemonic("BIT 1, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->L.getValue();
-		if ((reg1 & 0x02) == 0x02)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 1, (HL) Length: 2 Cycles 16 Opcode: 0x4E Flags: Z01-
-	case (uint8_t)0x4E: instruction.setMnemonic("BIT 1, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		reg1 = this->memory->read(addr);
-		if ((reg1 & 0x02) == 0x02)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 1, A Length: 2 Cycles 8 Opcode: 0x4F Flags: Z01-
-	case (uint8_t)0x4F: instruction.setMnemonic("BIT 1, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue();
-		if ((reg1 & 0x02) == 0x02)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 2, B Length: 2 Cycles 8 Opcode: 0x50 Flags: Z01-
-	case (uint8_t)0x50: instruction.setMnemonic("BIT 2, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->B.getValue();
-		if ((reg1 & 0x04) == 0x04)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 2, C Length: 2 Cycles 8 Opcode: 0x51 Flags: Z01-
-	case (uint8_t)0x51: instruction.setMnemonic("BIT 2, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->C.getValue();
-		if ((reg1 & 0x04) == 0x04)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 2, D Length: 2 Cycles 8 Opcode: 0x52 Flags: Z01-
-	case (uint8_t)0x52: instruction.setMnemonic("BIT 2, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->D.getValue();
-		if ((reg1 & 0x04) == 0x04)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;;
-		instructionCaught = true;
-		break;
-		// BIT 2, E Length: 2 Cycles 8 Opcode: 0x53 Flags: Z01-
-	case (uint8_t)0x53: instruction.setMnemonic("BIT 2, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->E.getValue();
-		if ((reg1 & 0x04) == 0x04)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 2, H Length: 2 Cycles 8 Opcode: 0x54 Flags: Z01-
-	case (uint8_t)0x54: instruction.setMnemonic("BIT 2, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->H.getValue();
-		if ((reg1 & 0x04) == 0x04)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 2, L Length: 2 Cycles 8 Opcode: 0x55 Flags: Z01-
-	case (uint8_t)0x55: instruction.setMnemonic("BIT 2, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->L.getValue();
-		if ((reg1 & 0x04) == 0x04)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 2, (HL) Length: 2 Cycles 16 Opcode: 0x56 Flags: Z01-
-	case (uint8_t)0x56: instruction.setMnemonic("BIT 2, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		reg1 = this->memory->read(addr);
-		if ((reg1 & 0x04) == 0x04)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 2, A Length: 2 Cycles 8 Opcode: 0x57 Flags: Z01-
-	case (uint8_t)0x57: instruction.setMnemonic("LD E, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue();
-		if ((reg1 & 0x04) == 0x04)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 3, B Length: 2 Cycles 8 Opcode: 0x58 Flags: Z01-
-	case (uint8_t)0x58: instruction.setMnemonic("BIT 3, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->B.getValue();
-		if ((reg1 & 0x08) == 0x08)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 3, C Length: 2 Cycles 8 Opcode: 0x59 Flags: Z01-
-	case (uint8_t)0x59: instruction.setMnemonic("BIT 3, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->C.getValue();
-		if ((reg1 & 0x08) == 0x08)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 3, D Length: 2 Cycles 8 Opcode: 0x5A Flags: Z01-
-	case (uint8_t)0x5A: instruction.setMnemonic("BIT 3, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->D.getValue();
-		if ((reg1 & 0x08) == 0x08)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 3, E Length: 2 Cycles 8 Opcode: 0x5B Flags: Z01-
-	case (uint8_t)0x5B: instruction.setMnemonic("BIT 3, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->E.getValue();
-		if ((reg1 & 0x08) == 0x08)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 3, H Length: 2 Cycles 8 Opcode: 0x5C Flags: Z01-
-	case (uint8_t)0x5C: instruction.setMnemonic("BIT 3, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->H.getValue();
-		if ((reg1 & 0x08) == 0x08)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 3, L Length: 2 Cycles 8 Opcode: 0x5D Flags: Z01-
-	case (uint8_t)0x5D: instruction.setMnemonic("BIT 3, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->L.getValue();
-		if ((reg1 & 0x08) == 0x08)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 3, (HL) Length: 2 Cycles 16 Opcode: 0x5E Flags: Z01-
-	case (uint8_t)0x5E: instruction.setMnemonic("BIT 3, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		reg1 = this->memory->read(addr);
-		if ((reg1 & 0x08) == 0x08)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 3, A Length: 2 Cycles 8 Opcode: 0x5F Flags: Z01-
-	case (uint8_t)0x5F: instruction.setMnemonic("BIT 3, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue();
-		if ((reg1 & 0x08) == 0x08)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 4, B Length: 2 Cycles 8 Opcode: 0x60 Flags: Z01-
-	case (uint8_t)0x60: instruction.setMnemonic("BIT 4, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->B.getValue();
-		if ((reg1 & 0x10) == 0x10)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 4, C Length: 2 Cycles 8 Opcode: 0x61 Flags: Z01-
-	case (uint8_t)0x61: instruction.setMnemonic("BIT 4, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->C.getValue();
-		if ((reg1 & 0x10) == 0x10)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 4, D Length: 2 Cycles 8 Opcode: 0x62 Flags: Z01-
-	case (uint8_t)0x62: instruction.setMnemonic("BIT 4, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->D.getValue();
-		if ((reg1 & 0x10) == 0x10)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 4, E Length: 2 Cycles 8 Opcode: 0x63 Flags: Z01-
-	case (uint8_t)0x63: instruction.setMnemonic("BIT 4, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->E.getValue();
-		if ((reg1 & 0x10) == 0x10)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 4, H Length: 2 Cycles 8 Opcode: 0x64 Flags: Z01-
-	case (uint8_t)0x64: instruction.setMnemonic("BIT 4, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->H.getValue();
-		if ((reg1 & 0x10) == 0x10)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 4, L Length: 2 Cycles 8 Opcode: 0x65 Flags: Z01-
-	case (uint8_t)0x65: instruction.setMnemonic("BIT 4, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->L.getValue();
-		if ((reg1 & 0x10) == 0x10)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 4, (HL) Length: 2 Cycles 16 Opcode: 0x66 Flags: Z01-
-	case (uint8_t)0x66: instruction.setMnemonic("BIT 4, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		reg1 = this->memory->read(addr);
-		if ((reg1 & 0x10) == 0x10)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 4, A Length: 2 Cycles 8 Opcode: 0x67 Flags: Z01-
-	case (uint8_t)0x67: instruction.setMnemonic("BIT 4, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue();
-		if ((reg1 & 0x10) == 0x10)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 5, B Length: 2 Cycles 8 Opcode: 0x68 Flags: Z01-
-	case (uint8_t)0x68: instruction.setMnemonic("BIT 5, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->B.getValue();
-		if ((reg1 & 0x20) == 0x20)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 5, C Length: 2 Cycles 8 Opcode: 0x69 Flags: Z01-
-	case (uint8_t)0x69: instruction.setMnemonic("BIT 5, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->C.getValue();
-		if ((reg1 & 0x20) == 0x20)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 5, D Length: 2 Cycles 8 Opcode: 0x6A Flags: Z01-
-	case (uint8_t)0x6A: instruction.setMnemonic("BIT 5, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->D.getValue();
-		if ((reg1 & 0x20) == 0x20)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 5, E Length: 2 Cycles 8 Opcode: 0x6B Flags: Z01-
-	case (uint8_t)0x6B: instruction.setMnemonic("BIT 5, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->E.getValue();
-		if ((reg1 & 0x20) == 0x20)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 5, H Length: 2 Cycles 8 Opcode: 0x6C Flags: Z01-
-	case (uint8_t)0x6C: instruction.setMnemonic("BIT 5, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->H.getValue();
-		if ((reg1 & 0x20) == 0x20)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 5, L Length: 2 Cycles 8 Opcode: 0x6D Flags: Z01-
-	case (uint8_t)0x6D: instruction.setMnemonic("BIT 5, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->L.getValue();
-		if ((reg1 & 0x20) == 0x20)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 5, (HL) Length: 2 Cycles 8 Opcode: 0x6E Flags: Z01-
-	case (uint8_t)0x6E: instruction.setMnemonic("BIT 5, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		reg1 = this->memory->read(addr);
-		if ((reg1 & 0x20) == 0x20)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 5, A Length: 2 Cycles 8 Opcode: 0x6F Flags: Z01-
-	case (uint8_t)0x6F: instruction.setMnemonic("BIT 5, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue();
-		if ((reg1 & 0x20) == 0x20)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 6, B Length: 2 Cycles 8 Opcode: 0x70 Flags: Z01-
-	case (uint8_t)0x70: instruction.setMnemonic("LD (HL), B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->B.getValue();
-		if ((reg1 & 0x40) == 0x40)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 6, C Length: 2 Cycles 8 Opcode: 0x71 Flags: Z01-
-	case (uint8_t)0x71: instruction.setMnemonic("BIT 6, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->C.getValue();
-		if ((reg1 & 0x40) == 0x40)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 6, D Length: 2 Cycles 8 Opcode: 0x72 Flags: Z01-
-	case (uint8_t)0x72: instruction.setMnemonic("BIT 6, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->D.getValue();
-		if ((reg1 & 0x40) == 0x40)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 6, E Length: 2 Cycles 8 Opcode: 0x73 Flags: Z01-
-	case (uint8_t)0x73: instruction.setMnemonic("BIT 6, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->E.getValue();
-		if ((reg1 & 0x40) == 0x40)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 6, H Length: 2 Cycles 8 Opcode: 0x74 Flags: Z01-
-	case (uint8_t)0x74: instruction.setMnemonic("BIT 6, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->H.getValue();
-		if ((reg1 & 0x40) == 0x40)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 6, L Length: 2 Cycles 16 Opcode: 0x75 Flags: Z01-
-	case (uint8_t)0x75: instruction.setMnemonic("BIT 6, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->L.getValue();
-		if ((reg1 & 0x40) == 0x40)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 6, (HL) Length: 2 Cycles 16 Opcode: 0x76 Flags: Z01-
-	case (uint8_t)0x76: instruction.setMnemonic("BIT 6, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		reg1 = this->memory->read(addr);
-		if ((reg1 & 0x40) == 0x40)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 6, A Length: 2 Cycles 8 Opcode: 0x77 Flags: Z01-
-	case (uint8_t)0x77: instruction.setMnemonic("BIT 6, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue();
-		if ((reg1 & 0x40) == 0x40)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 7, B Length: 2 Cycles 8 Opcode: 0x78 Flags: Z01-
-	case (uint8_t)0x78: instruction.setMnemonic("BIT 7, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->B.getValue();
-		if ((reg1 & 0x80) == 0x80)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 7, C Length: 2 Cycles 8 Opcode: 0x79 Flags: Z01-
-	case (uint8_t)0x79: instruction.setMnemonic("BIT 7, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->C.getValue();
-		if ((reg1 & 0x80) == 0x80)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 7, D Length: 2 Cycles 8 Opcode: 0x7A Flags: Z01-
-	case (uint8_t)0x7A: instruction.setMnemonic("BIT 7, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->D.getValue();
-		if ((reg1 & 0x80) == 0x80)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 7, E Length: 2 Cycles 8 Opcode: 0x7B Flags: Z01-
-	case (uint8_t)0x7B: instruction.setMnemonic("BIT 7, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->E.getValue();
-		if ((reg1 & 0x80) == 0x80)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 7, H Length: 2 Cycles 8 Opcode: 0x7C Flags: Z01-
-	case (uint8_t)0x7C: instruction.setMnemonic("BIT 7, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->H.getValue();
-		if ((reg1 & 0x80) == 0x80)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 7, L Length: 2 Cycles 8 Opcode: 0x7D Flags: Z01-
-	case (uint8_t)0x7D: instruction.setMnemonic("BIT 7, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->L.getValue();
-		if ((reg1 & 0x80) == 0x80)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 7, (HL) Length: 2 Cycles 16 Opcode: 0x7E Flags: Z01-
-	case (uint8_t)0x7E: instruction.setMnemonic("BIT 7, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		reg1 = this->memory->read(addr);
-		if ((reg1 & 0x80) == 0x80)
-		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
-		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// BIT 7, A Length: 2 Cycles 8 Opcode: 0x7F Flags: Z01-
-	case (uint8_t)0x7F: instruction.setMnemonic("BIT 7, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		reg1 = this->A.getValue();
-		if ((reg1 & 0x80) == 0x80)
+	}
+}
+//C on its own, without working out the rest of F. INC/DEC only pass the carry along, so a DEC B; JR NZ
+//loop never builds F at all
+bool CPU::pendingCarry()
+{
+	uint8_t left = this->registers.flagLeft, right = this->registers.flagRight;
+	uint8_t carry = this->registers.flagCarry ? 1 : 0;
+	switch (this->registers.flagOperation)
+	{
+	case FLAGS_RESOLVED:
+		return (this->registers.AF.low & FLAG_CARRY) != 0;
+	case FLAGS_ADD:
+		return (left + right + carry) > 0xFF;
+	case FLAGS_SUB:
+		return left < (right + carry);
+	case FLAGS_AND:
+	case FLAGS_LOGIC:
+	case FLAGS_INC:
+	case FLAGS_DEC:
+		return this->registers.flagCarry;
+	default:
+		return (this->readFlags() & FLAG_CARRY) != 0;
+	}
+}
+// tests the 2 bit condition field of a conditional branch opcode: NZ, Z, NC, C
+bool CPU::branchTaken(uint8_t opCode)
+{
+	bool taken;
+	switch ((opCode >> 3) & 0x3)
+	{
+	case 0: taken = !this->getFlag(FLAG_ZERO); break;
+	case 1: taken = this->getFlag(FLAG_ZERO); break;
+	case 2: taken = !this->getFlag(FLAG_CARRY); break;
+	default: taken = this->getFlag(FLAG_CARRY); break;
+	}
+	//the not taken cycles were counted when the instruction was fetched
+	if (taken)
+		this->registers.cycles += baseOpcodes[opCode].takenCycles - baseOpcodes[opCode].cycles;
+	return taken;
+}
+template<AluOperation OP> void CPU::alu(uint8_t value)
+{
+	uint8_t a = this->registers.AF.high;
+	uint8_t carry = 0;
+	if constexpr (OP == ALU_ADC || OP == ALU_SBC)
+		carry = this->getFlag(FLAG_CARRY) ? 1 : 0;
+	uint8_t result = 0;
+	if constexpr (OP == ALU_ADD || OP == ALU_ADC)
+	{
+		result = a + value + carry;
+		this->recordFlags(FLAGS_ADD, a, value, result, carry != 0);
+	}
+	else if constexpr (OP == ALU_SUB || OP == ALU_SBC || OP == ALU_CP)
+	{
+		result = a - value - carry;
+		this->recordFlags(FLAGS_SUB, a, value, result, carry != 0);
+	}
+	else if constexpr (OP == ALU_AND)
+	{
+		result = a & value;
+		this->recordFlags(FLAGS_AND, a, value, result, false);
+	}
+	else if constexpr (OP == ALU_XOR)
+	{
+		result = a ^ value;
+		this->recordFlags(FLAGS_LOGIC, a, value, result, false);
+	}
+	else
+	{
+		result = a | value;
+		this->recordFlags(FLAGS_LOGIC, a, value, result, false);
+	}
+	//CP only sets the flags
+	if constexpr (OP != ALU_CP)
+		this->registers.AF.high = result;
+}
+template<ShiftOperation OP> uint8_t CPU::rotateShift(uint8_t value)
+{
+	uint8_t result = 0;
+	bool carry = false;
+	if constexpr (OP == SHIFT_RLC)
+	{
+		carry = (value & 0x80) != 0;
+		result = (value << 1) | (value >> 7);
+	}
+	else if constexpr (OP == SHIFT_RRC)
+	{
+		carry = (value & 0x01) != 0;
+		result = (value >> 1) | (value << 7);
+	}
+	else if constexpr (OP == SHIFT_RL)
+	{
+		carry = (value & 0x80) != 0;
+		result = (value << 1) | (this->getFlag(FLAG_CARRY) ? 0x01 : 0x00);
+	}
+	else if constexpr (OP == SHIFT_RR)
+	{
+		carry = (value & 0x01) != 0;
+		result = (value >> 1) | (this->getFlag(FLAG_CARRY) ? 0x80 : 0x00);
+	}
+	else if constexpr (OP == SHIFT_SLA)
+	{
+		carry = (value & 0x80) != 0;
+		result = value << 1;
+	}
+	else if constexpr (OP == SHIFT_SRA)
+	{
+		carry = (value & 0x01) != 0;
+		result = (value >> 1) | (value & 0x80);
+	}
+	else if constexpr (OP == SHIFT_SWAP)
+	{
+		result = (value << 4) | (value >> 4);
+	}
+	else
+	{
+		carry = (value & 0x01) != 0;
+		result = value >> 1;
+	}
+	this->recordFlags(FLAGS_LOGIC, value, 0, result, carry);
+	return result;
+}
+
+//Base opcode handlers
+// NOP Length: 1 Cycles 4 Opcode: 0x00 Flags: ----
+void CPU::opNop(uint8_t)
+{
+}
+// LD rr, d16 Length: 3 Cycles 12 Opcode: 0x01/0x11/0x21/0x31 Flags: ----
+void CPU::opLdPairImmediate(uint8_t opCode)
+{
+	this->writePair((opCode >> 4) & 0x3, this->fetchWord());
+}
+// LD (BC)/(DE)/(HL+)/(HL-), A Length: 1 Cycles 8 Opcode: 0x02/0x12/0x22/0x32 Flags: ----
+void CPU::opStoreAccumulator(uint8_t opCode)
+{
+	uint16_t addr = 0;
+	switch ((opCode >> 4) & 0x3)
+	{
+	case 0: addr = this->registers.BC.pair; break;
+	case 1: addr = this->registers.DE.pair; break;
+	case 2: addr = this->registers.HL.pair; this->registers.HL.pair = addr + 1; break;
+	default: addr = this->registers.HL.pair; this->registers.HL.pair = addr - 1; break;
+	}
+	this->memory->write(addr, this->registers.AF.high);
+}
+// LD A, (BC)/(DE)/(HL+)/(HL-) Length: 1 Cycles 8 Opcode: 0x0A/0x1A/0x2A/0x3A Flags: ----
+void CPU::opLoadAccumulator(uint8_t opCode)
+{
+	uint16_t addr = 0;
+	switch ((opCode >> 4) & 0x3)
+	{
+	case 0: addr = this->registers.BC.pair; break;
+	case 1: addr = this->registers.DE.pair; break;
+	case 2: addr = this->registers.HL.pair; this->registers.HL.pair = addr + 1; break;
+	default: addr = this->registers.HL.pair; this->registers.HL.pair = addr - 1; break;
+	}
+	this->registers.AF.high = this->memory->read(addr);
+}
+// INC rr Length: 1 Cycles 8 Opcode: 0x03/0x13/0x23/0x33 Flags: ----
+void CPU::opIncPair(uint8_t opCode)
+{
+	uint8_t index = (opCode >> 4) & 0x3;
+	this->writePair(index, this->readPair(index) + 1);
+}
+// DEC rr Length: 1 Cycles 8 Opcode: 0x0B/0x1B/0x2B/0x3B Flags: ----
+void CPU::opDecPair(uint8_t opCode)
+{
+	uint8_t index = (opCode >> 4) & 0x3;
+	this->writePair(index, this->readPair(index) - 1);
+}
+// INC r Length: 1 Cycles 4 (12 for (HL)) Opcode: 0x04-0x3C Flags: Z0H-
+template<Operand R> void CPU::opIncOperand(uint8_t)
+{
+	uint8_t result = this->readOperand<R>() + 1;
+	this->writeOperand<R>(result);
+	this->recordFlags(FLAGS_INC, result - 1, 1, result, this->pendingCarry());
+}
+// DEC r Length: 1 Cycles 4 (12 for (HL)) Opcode: 0x05-0x3D Flags: Z1H-
+template<Operand R> void CPU::opDecOperand(uint8_t)
+{
+	uint8_t result = this->readOperand<R>() - 1;
+	this->writeOperand<R>(result);
+	this->recordFlags(FLAGS_DEC, result + 1, 1, result, this->pendingCarry());
+}
+// LD r, d8 Length: 2 Cycles 8 (12 for (HL)) Opcode: 0x06-0x3E Flags: ----
+template<Operand R> void CPU::opLdOperandImmediate(uint8_t)
+{
+	this->writeOperand<R>(this->fetchByte());
+}
+// RLCA Length: 1 Cycles 4 Opcode: 0x07 Flags: 000C
+void CPU::opRlca(uint8_t)
+{
+	this->registers.AF.high = this->rotateShift<SHIFT_RLC>(this->registers.AF.high);
+	this->writeFlags(this->readFlags() & FLAG_CARRY);
+}
+// RRCA Length: 1 Cycles 4 Opcode: 0x0F Flags: 000C
+void CPU::opRrca(uint8_t)
+{
+	this->registers.AF.high = this->rotateShift<SHIFT_RRC>(this->registers.AF.high);
+	this->writeFlags(this->readFlags() & FLAG_CARRY);
+}
+// RLA Length: 1 Cycles 4 Opcode: 0x17 Flags: 000C
+void CPU::opRla(uint8_t)
+{
+	this->registers.AF.high = this->rotateShift<SHIFT_RL>(this->registers.AF.high);
+	this->writeFlags(this->readFlags() & FLAG_CARRY);
+}
+// RRA Length: 1 Cycles 4 Opcode: 0x1F Flags: 000C
+void CPU::opRra(uint8_t)
+{
+	this->registers.AF.high = this->rotateShift<SHIFT_RR>(this->registers.AF.high);
+	this->writeFlags(this->readFlags() & FLAG_CARRY);
+}
+// LD (a16), SP Length: 3 Cycles 20 Opcode: 0x08 Flags: ----
+void CPU::opLdAddressSP(uint8_t)
+{
+	uint16_t addr = this->fetchWord();
+	this->memory->write(addr, (uint8_t)this->registers.SP);
+	this->memory->write(addr + 1, (uint8_t)(this->registers.SP >> 8));
+}
+// ADD HL, rr Length: 1 Cycles 8 Opcode: 0x09/0x19/0x29/0x39 Flags: -0HC
+void CPU::opAddHLPair(uint8_t opCode)
+{
+	uint16_t hl = this->registers.HL.pair;
+	uint16_t value = this->readPair((opCode >> 4) & 0x3);
+	this->registers.HL.pair = hl + value;
+	this->setFlags(this->getFlag(FLAG_ZERO), false, ((hl & 0xFFF) + (value & 0xFFF)) > 0xFFF, (hl + value) > 0xFFFF);
+}
+// STOP 0 Length: 2 Cycles 4 Opcode: 0x10 Flags: ----
+void CPU::opStop(uint8_t)
+{
+	this->setCpuState(STOP);
+}
+// JR r8 Length: 2 Cycles 12 Opcode: 0x18 Flags: ----
+void CPU::opJr(uint8_t)
+{
+	int8_t offset = (int8_t)this->fetchByte();
+	this->registers.PC += offset;
+}
+// JR cc, r8 Length: 2 Cycles 12/8 Opcode: 0x20/0x28/0x30/0x38 Flags: ----
+void CPU::opJrConditional(uint8_t opCode)
+{
+	int8_t offset = (int8_t)this->fetchByte();
+	if (this->branchTaken(opCode))
+		this->registers.PC += offset;
+}
+// DAA Length: 1 Cycles 4 Opcode: 0x27 Flags: Z-0C
+void CPU::opDaa(uint8_t)
+{
+	uint8_t a = this->registers.AF.high;
+	bool carry = this->getFlag(FLAG_CARRY);
+	if (!this->getFlag(FLAG_SUBTRACT))
+	{
+		if (carry || a > 0x99)
 		{
-			this->F.setValue(this->F.getValue() & 0b00110000);
+			a += 0x60;
+			carry = true;
 		}
-		else
-			this->F.setValue(this->F.getValue() | 0b10000000);
-		this->F.setValue(this->F.getValue() | 0b00100000);
-		this->F.setValue(this->F.getValue() & 0b10110000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 0, B Length: 2 Cycles 8 Opcode: 0x80 Flags: ----
-	case (uint8_t)0x80: instruction.setMnemonic("RES 0, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->B.setValue(this->B.getValue() & 0b11111110);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 0, C Length: 2 Cycles 8 Opcode: 0x81 Flags: ----
-	case (uint8_t)0x81: instruction.setMnemonic("RES 0, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->C.setValue(this->C.getValue() & 0b11111110);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 0, D Length: 2 Cycles 8 Opcode: 0x82 Flags: ----
-	case (uint8_t)0x82: instruction.setMnemonic("RES 0, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->D.setValue(this->D.getValue() & 0b11111110);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 0, E Length: 2 Cycles 8 Opcode: 0x83 Flags: ----
-	case (uint8_t)0x83: instruction.setMnemonic("RES 0, E");
-		cout << instruction.getMnemonic() << endl;
-		this->E.setValue(this->E.getValue() & 0b11111110);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 0, H Length: 2 Cycles 8 Opcode: 0x84 Flags: ----
-	case (uint8_t)0x84: instruction.setMnemonic("RES 0, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->H.setValue(this->H.getValue() & 0b11111110);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 0, L Length: 2 Cycles 8 Opcode: 0x85 Flags: ----
-	case (uint8_t)0x85: instruction.setMnemonic("RES 0, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->L.setValue(this->L.getValue() & 0b11111110);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 0, (HL) Length: 2 Cycles 16 Opcode: 0x86 Flags: ----
-	case (uint8_t)0x86: instruction.setMnemonic("RES 0, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		reg1 = this->memory->read(addr);
-		reg1 = reg1 & 0b11111110;
-		this->memory->write(addr, reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 0, A Length: 2 Cycles 8 Opcode: 0x87 Flags: ----
-	case (uint8_t)0x87: instruction.setMnemonic("RES 0, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->A.setValue(this->A.getValue() & 0b11111110);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 1, B Length: 2 Cycles 8 Opcode: 0x88 Flags: ----
-	case (uint8_t)0x88: instruction.setMnemonic("RES 1, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->B.setValue(this->B.getValue() & 0b11111101);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 1, C Length: 2 Cycles 8 Opcode: 0x89 Flags: ----
-	case (uint8_t)0x89: instruction.setMnemonic("RES 1, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->C.setValue(this->C.getValue() & 0b11111101);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 1, D Length: 2 Cycles 8 Opcode: 0x8A Flags: ----
-	case (uint8_t)0x8A: instruction.setMnemonic("RES 1, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->D.setValue(this->D.getValue() & 0b11111101);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 1, E Length: 2 Cycles 8 Opcode: 0x8B Flags: ----
-	case (uint8_t)0x8B: instruction.setMnemonic("RES 1, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->E.setValue(this->E.getValue() & 0b11111101);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 1, H Length: 2 Cycles 8 Opcode: 0x8C Flags: ----
-	case (uint8_t)0x8C: instruction.setMnemonic("RES 1, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->H.setValue(this->H.getValue() & 0b11111101);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 1, L Length: 2 Cycles 8 Opcode: 0x8D Flags: ----
-	case (uint8_t)0x8D: instruction.setMnemonic("RES 1, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->L.setValue(this->L.getValue() & 0b11111101);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 1, (HL) Length: 2 Cycles 8 Opcode: 0x8E Flags: ----
-	case (uint8_t)0x8E: instruction.setMnemonic("RES 1, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		reg1 = this->memory->read(addr);
-		reg1 = reg1 & 0b11111101;
-		this->memory->write(addr, reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 1, A Length: 2 Cycles 8 Opcode: 0x8F Flags: ----
-	case (uint8_t)0x8F: instruction.setMnemonic("RES 1, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->A.setValue(this->A.getValue() & 0b11111101);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 2, B Length: 2 Cycles 8 Opcode: 0x90 Flags: ----
-	case (uint8_t)0x90: instruction.setMnemonic("RES 2, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->B.setValue(this->B.getValue() & 0b11111011);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 2, C Length: 2 Cycles 8 Opcode: 0x91 Flags: ----
-	case (uint8_t)0x91: instruction.setMnemonic("RES 2, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->C.setValue(this->C.getValue() & 0b11111011);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 2, D Length: 2 Cycles 8 Opcode: 0x92 Flags: ----
-	case (uint8_t)0x92: instruction.setMnemonic("RES 2, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->D.setValue(this->D.getValue() & 0b11111011);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 2, E Length: 2 Cycles 8 Opcode: 0x93 Flags: ----
-	case (uint8_t)0x93: instruction.setMnemonic("RES 2, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->E.setValue(this->E.getValue() & 0b11111011);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 2, H Length: 2 Cycles 8 Opcode: 0x94 Flags: ----
-	case (uint8_t)0x94: instruction.setMnemonic("RES 2, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->H.setValue(this->H.getValue() & 0b11111011);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 2, L Length: 2 Cycles 8 Opcode: 0x95 Flags: ----
-	case (uint8_t)0x95: instruction.setMnemonic("RES 2, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->L.setValue(this->L.getValue() & 0b11111011);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 2, (HL) Length: 2 Cycles 16 Opcode: 0x96 Flags: ----
-	case (uint8_t)0x96: instruction.setMnemonic("RES 2, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		reg1 = this->memory->read(addr);
-		reg1 = reg1 & 0b11111011;
-		this->memory->write(addr, reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 2, A Length: 2 Cycles 8 Opcode: 0x97 Flags: ----
-	case (uint8_t)0x97: instruction.setMnemonic("RES 2, A");
-		cout << instruction.getMnemonic() << endl;
-		this->A.setValue(this->A.getValue() & 0b11111011);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 3, B Length: 2 Cycles 8 Opcode: 0x98 Flags: ----
-	case (uint8_t)0x98: instruction.setMnemonic("RES 3, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->B.setValue(this->B.getValue() & 0b11110111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 3, C Length: 2 Cycles 8 Opcode: 0x99 Flags: ----
-	case (uint8_t)0x99: instruction.setMnemonic("RES 3, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->C.setValue(this->C.getValue() & 0b11110111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 3, D Length: 2 Cycles 8 Opcode: 0x9A Flags: ----
-	case (uint8_t)0x9A: instruction.setMnemonic("RES 3, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->D.setValue(this->D.getValue() & 0b11110111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 3, E Length: 2 Cycles 8 Opcode: 0x9B Flags: ----
-	case (uint8_t)0x9B: instruction.setMnemonic("RES 3, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->E.setValue(this->E.getValue() & 0b11110111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 3, H Length: 2 Cycles 8 Opcode: 0x9C Flags: ----
-	case (uint8_t)0x9C: instruction.setMnemonic("RES 3, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->H.setValue(this->H.getValue() & 0b11110111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 3, L Length: 2 Cycles 8 Opcode: 0x9D Flags: ----
-	case (uint8_t)0x9D: instruction.setMnemonic("RES 3, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->L.setValue(this->L.getValue() & 0b11110111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 3, (HL) Length: 2 Cycles 16 Opcode: 0x9E Flags: ----
-	case (uint8_t)0x9E: instruction.setMnemonic("RES 3, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		reg1 = this->memory->read(addr);
-		reg1 = reg1 & 0b11110111;
-		this->memory->write(addr, reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 3, A Length: 2 Cycles 8 Opcode: 0x9F Flags: ----
-	case (uint8_t)0x9F: instruction.setMnemonic("RES 3, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->A.setValue(this->A.getValue() & 0b11110111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 4, B Length: 2 Cycles 8 Opcode: 0xA0 Flags: ----
-	case (uint8_t)0xA0: instruction.setMnemonic("RES 4, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->B.setValue(this->B.getValue() & 0b11101111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 4, C Length: 2 Cycles 8 Opcode: 0xA1 Flags: ----
-	case (uint8_t)0xA1: instruction.setMnemonic("RES 4, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->C.setValue(this->C.getValue() & 0b11101111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 4, D Length: 2 Cycles 8 Opcode: 0xA2 Flags: ----
-	case (uint8_t)0xA2: instruction.setMnemonic("RES 4, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->D.setValue(this->D.getValue() & 0b11101111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 4, E Length: 2 Cycles 8 Opcode: 0xA3 Flags: ----
-	case (uint8_t)0xA3: instruction.setMnemonic("RES 4, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->E.setValue(this->E.getValue() & 0b11101111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 4, H Length: 2 Cycles 8 Opcode: 0xA4 Flags: ----
-	case (uint8_t)0xA4: instruction.setMnemonic("RES 4, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->H.setValue(this->H.getValue() & 0b11101111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 4, L Length: 2 Cycles 8 Opcode: 0xA5 Flags: ----
-	case (uint8_t)0xA5: instruction.setMnemonic("RES 4, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->L.setValue(this->L.getValue() & 0b11101111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 4, (HL) Length: 2 Cycles 8 Opcode: 0xA6 Flags: ----
-	case (uint8_t)0xA6: instruction.setMnemonic("RES 4, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		reg1 = this->memory->read(addr);
-		reg1 = reg1 & 0b11101111;
-		this->memory->write(addr, reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 4, A Length: 2 Cycles 8 Opcode: 0xA7 Flags: ----
-	case (uint8_t)0xA7: instruction.setMnemonic("RES 4, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->A.setValue(this->A.getValue() & 0b11101111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 5, B Length: 2 Cycles 8 Opcode: 0xA8 Flags: ----
-	case (uint8_t)0xA8: instruction.setMnemonic("RES 5, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->B.setValue(this->B.getValue() & 0b11011111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 5, C Length: 2 Cycles 8 Opcode: 0xA9 Flags: ----
-	case (uint8_t)0xA9: instruction.setMnemonic("RES 5, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->C.setValue(this->C.getValue() & 0b11011111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 5, D Length: 2 Cycles 8 Opcode: 0xAA Flags: ----
-	case (uint8_t)0xAA: instruction.setMnemonic("RES 5, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->D.setValue(this->D.getValue() & 0b11011111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 5, E Length: 2 Cycles 8 Opcode: 0xAB Flags: ----
-	case (uint8_t)0xAB: instruction.setMnemonic("RES 5, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->E.setValue(this->E.getValue() & 0b11011111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 5, H Length: 2 Cycles 8 Opcode: 0xAC Flags: ----
-	case (uint8_t)0xAC: instruction.setMnemonic("RES 5, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->H.setValue(this->H.getValue() & 0b11011111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 5, L Length: 2 Cycles 8 Opcode: 0xAD Flags: ----
-	case (uint8_t)0xAD: instruction.setMnemonic("RES 5, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->L.setValue(this->L.getValue() & 0b11011111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 5, (HL) Length: 2 Cycles 8 Opcode: 0xAE Flags: ----
-	case (uint8_t)0xAE: instruction.setMnemonic("RES 5, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		reg1 = this->memory->read(addr);
-		reg1 = reg1 & 0b11011111;
-		this->memory->write(addr, reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 5, A Length: 2 Cycles 8 Opcode: 0xAF Flags: ----
-	case (uint8_t)0xAF: instruction.setMnemonic("RES 5, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->A.setValue(this->A.getValue() & 0b11011111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 6, B Length: 2 Cycles 8 Opcode: 0xB0 Flags: ----
-	case (uint8_t)0xB0: instruction.setMnemonic("RES 6, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->B.setValue(this->B.getValue() & 0b10111111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 6, C Length: 2 Cycles 8 Opcode: 0xB1 Flags: ----
-	case (uint8_t)0xB1: instruction.setMnemonic("RES 6, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->C.setValue(this->C.getValue() & 0b10111111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 6, D Length: 2 Cycles 8 Opcode: 0xB2 Flags: ----
-	case (uint8_t)0xB2: instruction.setMnemonic("RES 6, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->D.setValue(this->D.getValue() & 0b10111111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 6, E Length: 2 Cycles 8 Opcode: 0xB3 Flags: ----
-	case (uint8_t)0xB3: instruction.setMnemonic("RES 6, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->E.setValue(this->E.getValue() & 0b10111111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 6, H Length: 2 Cycles 8 Opcode: 0xB4 Flags: ----
-	case (uint8_t)0xB4: instruction.setMnemonic("RES 6, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->H.setValue(this->H.getValue() & 0b10111111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 6, L Length: 2 Cycles 8 Opcode: 0xB5 Flags: ----
-	case (uint8_t)0xB5: instruction.setMnemonic("RES 6, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->L.setValue(this->L.getValue() & 0b10111111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 6, (HL) Length: 2 Cycles 16 Opcode: 0xB6 Flags: ----
-	case (uint8_t)0xB6: instruction.setMnemonic("RES 6, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		reg1 = this->memory->read(addr);
-		reg1 = reg1 & 0b10111111;
-		this->memory->write(addr, reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 6, A Length: 2 Cycles 8 Opcode: 0xB7 Flags: ----
-	case (uint8_t)0xB7: instruction.setMnemonic("RES 6, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->A.setValue(this->A.getValue() & 0b10111111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 7, B Length: 2 Cycles 8 Opcode: 0xB8 Flags: ----
-	case (uint8_t)0xB8: instruction.setMnemonic("RES 7, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->B.setValue(this->B.getValue() & 0b01111111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 7, C Length: 2 Cycles 8 Opcode: 0xB9 Flags: ----
-	case (uint8_t)0xB9: instruction.setMnemonic("RES 7, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->C.setValue(this->C.getValue() & 0b01111111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 7, D Length: 2 Cycles 8 Opcode: 0xBA Flags: ----
-	case (uint8_t)0xBA: instruction.setMnemonic("RES 7, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->D.setValue(this->D.getValue() & 0b01111111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 7, E Length: 2 Cycles 8 Opcode: 0xBB Flags: ----
-	case (uint8_t)0xBB: instruction.setMnemonic("RES 7, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->E.setValue(this->E.getValue() & 0b01111111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 7, H Length: 2 Cycles 8 Opcode: 0xBC Flags: ----
-	case (uint8_t)0xBC: instruction.setMnemonic("RES 7, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->H.setValue(this->H.getValue() & 0b01111111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 7, L Length: 2 Cycles 8 Opcode: 0xBD Flags: ----
-	case (uint8_t)0xBD: instruction.setMnemonic("RES 7, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->L.setValue(this->L.getValue() & 0b01111111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 7, (HL) Length: 2 Cycles 16 Opcode: 0xBE Flags: ----
-	case (uint8_t)0xBE: instruction.setMnemonic("RES 7, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		reg1 = this->memory->read(addr);
-		reg1 = reg1 & 0b01111111;
-		this->memory->write(addr, reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// RES 7, A Length: 2 Cycles 8 Opcode: 0xBF Flags: ----
-	case (uint8_t)0xBF: instruction.setMnemonic("RES 7, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->A.setValue(this->A.getValue() & 0b01111111);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 0, B Length: 2 Cycles 8 Opcode: 0xC0 Flags: ----
-	case (uint8_t)0xC0: instruction.setMnemonic("SET 0, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->B.setValue(this->B.getValue() | 0b00000001);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 0, C Length: 2 Cycles 8 Opcode: 0xC1 Flags: ----
-	case (uint8_t)0xC1: instruction.setMnemonic("SET 0, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->C.setValue(this->C.getValue() | 0b00000001);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 0, D Length: 2 Cycles 8 Opcode: 0xC2 Flags: ----
-	case (uint8_t)0xC2: instruction.setMnemonic("SET 0, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->D.setValue(this->D.getValue() | 0b00000001);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 0, E Length: 2 Cycles 8 Opcode: 0xC3 Flags: ----
-	case (uint8_t)0xC3: instruction.setMnemonic("SET 0, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->E.setValue(this->E.getValue() | 0b00000001);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 0, H Length: 2 Cycles 8 Opcode: 0xC4 Flags: ----
-	case (uint8_t)0xC4: instruction.setMnemonic("SET 0, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->H.setValue(this->H.getValue() | 0b00000001);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 0, L Length: 2 Cycles 8 Opcode: 0xC5 Flags: ----
-	case (uint8_t)0xC5: instruction.setMnemonic("SET 0, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->L.setValue(this->L.getValue() | 0b00000001);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 0, (HL) Length: 2 Cycles 16 Opcode: 0xC6 Flags: ----
-	case (uint8_t)0xC6: instruction.setMnemonic("SET 0, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		reg1 = this->memory->read(addr);
-		reg1 = reg1 | 0b00000001;
-		this->memory->write(addr, reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 0, A Length: 2 Cycles 8 Opcode: 0xC7 Flags: ----
-	case (uint8_t)0xC7: instruction.setMnemonic("SET 0, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->A.setValue(this->A.getValue() | 0b00000001);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 1, B Length: 2 Cycles 8 Opcode: 0xC8 Flags: ----
-	case (uint8_t)0xC8: instruction.setMnemonic("SET 1, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->B.setValue(this->B.getValue() | 0b00000010);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 1, C Length: 2 Cycles 8 Opcode: 0xC9 Flags: ----
-	case (uint8_t)0xC9: instruction.setMnemonic("SET 1, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->C.setValue(this->C.getValue() | 0b00000010);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 1, D Length: 2 Cycles 8 Opcode: 0xCA Flags: ----
-	case (uint8_t)0xCA: instruction.setMnemonic("SET 1, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->D.setValue(this->D.getValue() | 0b00000010);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 1, E Length: 2 Cycles 8 Opcode: 0xCB Flags: ----
-	case (uint8_t)0xCB: instruction.setMnemonic("SET 1, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->E.setValue(this->E.getValue() | 0b00000010);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 1, H Length: 2 Cycles 8 Opcode: 0xCC Flags: ----
-	case (uint8_t)0xCC: instruction.setMnemonic("SET 1, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->H.setValue(this->H.getValue() | 0b00000010);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 1, L Length: 2 Cycles 8 Opcode: 0xCD Flags: ----
-	case (uint8_t)0xCD: instruction.setMnemonic("SET 1, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->L.setValue(this->L.getValue() | 0b00000010);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 1, (HL) Length: 2 Cycles 16 Opcode: 0xCE Flags: ----
-	case (uint8_t)0xCE: instruction.setMnemonic("SET 1, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		reg1 = this->memory->read(addr);
-		reg1 = reg1 | 0b00000010;
-		this->memory->write(addr, reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 1, A Length: 2 Cycles 8 Opcode: 0xCF Flags: ----
-	case (uint8_t)0xCF: instruction.setMnemonic("SET 1, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->A.setValue(this->A.getValue() | 0b00000010);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 2, B Length: 2 Cycles 8 Opcode: 0xD0 Flags: ----
-	case (uint8_t)0xD0: instruction.setMnemonic("SET 2, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->B.setValue(this->B.getValue() | 0b00000100);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 2, C Length: 2 Cycles 8 Opcode: 0xD1 Flags: ----
-	case (uint8_t)0xD1: instruction.setMnemonic("SET 2, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->C.setValue(this->C.getValue() | 0b00000100);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 2, D Length: 2 Cycles 8 Opcode: 0xD2 Flags: ----
-	case (uint8_t)0xD2: instruction.setMnemonic("SET 2, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->D.setValue(this->D.getValue() | 0b00000100);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 2, E Length: 2 Cycles 8 Opcode: 0xD3 Flags: ----
-	case (uint8_t)0xD3: instruction.setMnemonic("SET 2, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->E.setValue(this->E.getValue() | 0b00000100);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 2, H Length: 2 Cycles 8 Opcode: 0xD4 Flags: ----
-	case (uint8_t)0xD4: instruction.setMnemonic("SET 2, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->H.setValue(this->H.getValue() | 0b00000100);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 2, L Length: 2 Cycles 8 Opcode: 0xD5 Flags: ----
-	case (uint8_t)0xD5: instruction.setMnemonic("SET 2, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->L.setValue(this->L.getValue() | 0b00000100);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 2, (HL) Length: 2 Cycles 16 Opcode: 0xD6 Flags: ----
-	case (uint8_t)0xD6: instruction.setMnemonic("SET 2, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		reg1 = this->memory->read(addr);
-		reg1 = reg1 | 0b00000100;
-		this->memory->write(addr, reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 2, A Length: 2 Cycles 8 Opcode: 0xD7 Flags: ----
-	case (uint8_t)0xD7: instruction.setMnemonic("SET 2, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->A.setValue(this->A.getValue() | 0b00000100);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 3, B Length: 2 Cycles 8 Opcode: 0xD8 Flags: ----
-	case (uint8_t)0xD8: instruction.setMnemonic("SET 3, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->B.setValue(this->B.getValue() | 0b00001000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 3, C Length: 2 Cycles 8 Opcode: 0xD9 Flags: ----
-	case (uint8_t)0xD9: instruction.setMnemonic("SET 3, C");
-		cout << instruction.getMnemonic() << endl;
-		this->C.setValue(this->C.getValue() | 0b00001000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 3, D Length: 2 Cycles 8 Opcode: 0xDA Flags: ----
-	case (uint8_t)0xDA: instruction.setMnemonic("SET 3, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->D.setValue(this->D.getValue() | 0b00001000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 3, E Length: 2 Cycles 8 Opcode: 0xDB Flags: ----
-	case (uint8_t)0xDB:instruction.setMnemonic("SET 3, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->E.setValue(this->E.getValue() | 0b00001000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 3, H Length: 2 Cycles 8 Opcode: 0xDC Flags: ----
-	case (uint8_t)0xDC: instruction.setMnemonic("SET 3, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->H.setValue(this->H.getValue() | 0b00001000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 3, L Length: 2 Cycles 8 Opcode: 0xDD Flags: ----
-	case (uint8_t)0xDD:instruction.setMnemonic("SET 3, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->L.setValue(this->L.getValue() | 0b00001000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 3, (HL) Length: 2 Cycles 16 Opcode: 0xDE Flags: ----
-	case (uint8_t)0xDE: instruction.setMnemonic("SET 3, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		reg1 = this->memory->read(addr);
-		reg1 = reg1 | 0b00001000;
-		this->memory->write(addr, reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 3, A Length: 2 Cycles 8 Opcode: 0xDF Flags: ----
-	case (uint8_t)0xDF: instruction.setMnemonic("SET 3, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->A.setValue(this->A.getValue() | 0b00001000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 4, B Length: 2 Cycles 8 Opcode: 0xE0 Flags: ----
-	case (uint8_t)0xE0: instruction.setMnemonic("SET 4, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->B.setValue(this->B.getValue() | 0b00010000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 4, C Length: 2 Cycles 8 Opcode: 0xE1 Flags: ----
-	case (uint8_t)0xE1: instruction.setMnemonic("SET 4, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->C.setValue(this->C.getValue() | 0b00010000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 4, D Length: 2 Cycles 8 Opcode: 0xE2 Flags: ----
-	case (uint8_t)0xE2: instruction.setMnemonic("SET 4, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->D.setValue(this->D.getValue() | 0b00010000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 4, E Length: 2 Cycles 8 Opcode: 0xE3 Flags: ----
-	case (uint8_t)0xE3: instruction.setMnemonic("SET 4, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->E.setValue(this->E.getValue() | 0b00010000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 4, H Length: 2 Cycles 8 Opcode: 0xE4 Flags: ----
-	case (uint8_t)0xE4: instruction.setMnemonic("SET 4, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->H.setValue(this->H.getValue() | 0b00010000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 4, L Length: 2 Cycles 8 Opcode: 0xE5 Flags: ----
-	case (uint8_t)0xE5: instruction.setMnemonic("SET 4, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->L.setValue(this->L.getValue() | 0b00010000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 4, (HL) Length: 2 Cycles 16 Opcode: 0xE6 Flags: ----
-	case (uint8_t)0xE6: instruction.setMnemonic("SET 4, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		reg1 = this->memory->read(addr);
-		reg1 = reg1 | 0b00010000;
-		this->memory->write(addr, reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 4, A Length: 2 Cycles 8 Opcode: 0xE7 Flags: ----
-	case (uint8_t)0xE7: instruction.setMnemonic("SET 4, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->A.setValue(this->A.getValue() | 0b00010000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 5, B Length: 2 Cycles 8 Opcode: 0xE8 Flags: ----
-	case (uint8_t)0xE8: instruction.setMnemonic("SET 5, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->B.setValue(this->B.getValue() | 0b00100000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 5, C Length: 2 Cycles 8 Opcode: 0xE9 Flags: ----
-	case (uint8_t)0xE9: instruction.setMnemonic("SET 5, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->C.setValue(this->C.getValue() | 0b00100000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 5, D Length: 2 Cycles 8 Opcode: 0xEA Flags: ----
-	case (uint8_t)0xEA: instruction.setMnemonic("SET 5, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->D.setValue(this->D.getValue() | 0b00100000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 5, E Length: 2 Cycles 8 Opcode: 0xEB Flags: ----
-	case (uint8_t)0xEB: instruction.setMnemonic("SET 5, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->E.setValue(this->E.getValue() | 0b00100000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 5, H Length: 2 Cycles 8 Opcode: 0xEC Flags: ----
-	case (uint8_t)0xEC: instruction.setMnemonic("SET 5, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->H.setValue(this->H.getValue() | 0b00100000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 5, L Length: 2 Cycles 8 Opcode: 0xED Flags: ----
-	case (uint8_t)0xED: instruction.setMnemonic("SET 5, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->L.setValue(this->L.getValue() | 0b00100000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 5, (HL) Length: 2 Cycles 8 Opcode: 0xEE Flags: ----
-	case (uint8_t)0xEE: instruction.setMnemonic("SET 5, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		reg1 = this->memory->read(addr);
-		reg1 = reg1 | 0b00100000;
-		this->memory->write(addr, reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 5, A Length: 2 Cycles 8 Opcode: 0xEF Flags: ----
-	case (uint8_t)0xEF: instruction.setMnemonic("SET 5, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->A.setValue(this->A.getValue() | 0b00100000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 6, B Length: 2 Cycles 8 Opcode: 0xF0 Flags: ----
-	case (uint8_t)0xF0: instruction.setMnemonic("SET 6, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->B.setValue(this->B.getValue() | 0b01000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 6, C Length: 2 Cycles 8 Opcode: 0xF1 Flags: ----
-	case (uint8_t)0xF1: instruction.setMnemonic("SET 6, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->C.setValue(this->C.getValue() | 0b01000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 6, D Length: 2 Cycles 8 Opcode: 0xF2 Flags: ----
-	case (uint8_t)0xF2: instruction.setMnemonic("SET 6, D");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->D.setValue(this->D.getValue() | 0b01000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 6, E Length: 2 Cycles 8 Opcode: 0xF3 Flags: ----
-	case (uint8_t)0xF3: instruction.setMnemonic("SET 6, E");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->E.setValue(this->E.getValue() | 0b01000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 6, H Length: 2 Cycles 8 Opcode: 0xF4 Flags: ----
-	case (uint8_t)0xF4: instruction.setMnemonic("SET 6, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->H.setValue(this->H.getValue() | 0b01000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 6, L Length: 2 Cycles 8 Opcode: 0xF5 Flags: ----
-	case (uint8_t)0xF5: instruction.setMnemonic("SET 6, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->L.setValue(this->L.getValue() | 0b01000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 6, (HL) Length: 2 Cycles 16 Opcode: 0xF6 Flags: ----
-	case (uint8_t)0xF6: instruction.setMnemonic("SET 6, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		reg1 = this->memory->read(addr);
-		reg1 = reg1 | 0b01000000;
-		this->memory->write(addr, reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 6, A Length: 2 Cycles 8 Opcode: 0xF7 Flags: ----
-	case (uint8_t)0xF7: instruction.setMnemonic("SET 6, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->A.setValue(this->A.getValue() | 0b01000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 7, B Length: 2 Cycles 8 Opcode: 0xF8 Flags: ----
-	case (uint8_t)0xF8: instruction.setMnemonic("SET 7, B");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->B.setValue(this->B.getValue() | 0b10000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 7, C Length: 2 Cycles 8 Opcode: 0xF9 Flags: ----
-	case (uint8_t)0xF9: instruction.setMnemonic("SET 7, C");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->C.setValue(this->C.getValue() | 0b10000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 7, D Length: 2 Cycles 8 Opcode: 0xFA Flags: ----
-	case (uint8_t)0xFA: instruction.setMnemonic("SET 7, D");//DPNE
-		cout << instruction.getMnemonic() << endl;
-		this->D.setValue(this->D.getValue() | 0b10000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 7, E Length: 2 Cycles 8 Opcode: 0xFB Flags: ----
-	case (uint8_t)0xFB: instruction.setMnemonic("SET 7, E");
-		cout << instruction.getMnemonic() << endl;
-		this->E.setValue(this->E.getValue() | 0b10000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 7, H Length: 2 Cycles 8 Opcode: 0xFC Flags: ----
-	case (uint8_t)0xFC: instruction.setMnemonic("SET 7, H");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->H.setValue(this->H.getValue() | 0b10000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 7, L Length: 2 Cycles 8 Opcode: 0xFD Flags: ----
-	case (uint8_t)0xFD: instruction.setMnemonic("SET 7, L");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->L.setValue(this->L.getValue() | 0b10000000);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 7, (HL) Length: 2 Cycles 8 Opcode: 0xFE Flags: ----
-	case (uint8_t)0xFE: instruction.setMnemonic("SET 7, (HL)");//DONE
-		cout << instruction.getMnemonic() << endl;
-		addr = ((this->H.getValue() >> 8) & 0xFF00) | (this->L.getValue() & 0x00FF);
-		reg1 = this->memory->read(addr);
-		reg1 = reg1 | 0b10000000;
-		this->memory->write(addr, reg1);
-		PC++;
-		instructionCaught = true;
-		break;
-		// SET 7, A Length: 2 Cycles 8 Opcode: 0xFF Flags: ----
-	case (uint8_t)0xFF: instruction.setMnemonic("SET 7, A");//DONE
-		cout << instruction.getMnemonic() << endl;
-		this->A.setValue(this->A.getValue() | 0b10000000);
-		PC++;
-		instructionCaught = true;
-		break;
+		if (this->getFlag(FLAG_HALF_CARRY) || (a & 0xF) > 0x9)
+			a += 0x06;
+	}
+	else
+	{
+		if (carry)
+			a -= 0x60;
+		if (this->getFlag(FLAG_HALF_CARRY))
+			a -= 0x06;
+	}
+	this->registers.AF.high = a;
+	this->setFlags(a == 0, this->getFlag(FLAG_SUBTRACT), false, carry);
+}
+// CPL Length: 1 Cycles 4 Opcode: 0x2F Flags: -11-
+void CPU::opCpl(uint8_t)
+{
+	this->registers.AF.high = ~this->registers.AF.high;
+	this->writeFlags(this->readFlags() | FLAG_SUBTRACT | FLAG_HALF_CARRY);
+}
+// SCF Length: 1 Cycles 4 Opcode: 0x37 Flags: -001
+void CPU::opScf(uint8_t)
+{
+	this->setFlags(this->getFlag(FLAG_ZERO), false, false, true);
+}
+// CCF Length: 1 Cycles 4 Opcode: 0x3F Flags: -00C
+void CPU::opCcf(uint8_t)
+{
+	this->setFlags(this->getFlag(FLAG_ZERO), false, false, !this->getFlag(FLAG_CARRY));
+}
+// LD r, r' Length: 1 Cycles 4 (8 for (HL)) Opcode: 0x40-0x7F Flags: ----
+template<Operand DST, Operand SRC> void CPU::opLdOperandOperand(uint8_t)
+{
+	this->writeOperand<DST>(this->readOperand<SRC>());
+}
+// HALT Length: 1 Cycles 4 Opcode: 0x76 Flags: ----
+void CPU::opHalt(uint8_t)
+{
+	this->setCpuState(HALT);
+}
+// ADD/ADC/SUB/SBC/AND/XOR/OR/CP r Length: 1 Cycles 4 (8 for (HL)) Opcode: 0x80-0xBF Flags: Z*HC
+template<AluOperation OP, Operand R> void CPU::opAluOperand(uint8_t)
+{
+	this->alu<OP>(this->readOperand<R>());
+}
+// ADD/ADC/SUB/SBC/AND/XOR/OR/CP d8 Length: 2 Cycles 8 Opcode: 0xC6-0xFE Flags: Z*HC
+template<AluOperation OP> void CPU::opAluImmediate(uint8_t)
+{
+	this->alu<OP>(this->fetchByte());
+}
+// RET Length: 1 Cycles 16 Opcode: 0xC9 Flags: ----
+void CPU::opRet(uint8_t)
+{
+	this->registers.PC = this->popWord();
+}
+// RETI Length: 1 Cycles 16 Opcode: 0xD9 Flags: ----
+void CPU::opReti(uint8_t)
+{
+	this->registers.PC = this->popWord();
+	this->setInteruptStatus(true);
+}
+// RET cc Length: 1 Cycles 20/8 Opcode: 0xC0/0xC8/0xD0/0xD8 Flags: ----
+void CPU::opRetConditional(uint8_t opCode)
+{
+	if (this->branchTaken(opCode))
+		this->registers.PC = this->popWord();
+}
+// POP rr Length: 1 Cycles 12 Opcode: 0xC1/0xD1/0xE1/0xF1 Flags: ---- (ZNHC for AF)
+void CPU::opPop(uint8_t opCode)
+{
+	uint16_t value = this->popWord();
+	uint8_t index = (opCode >> 4) & 0x3;
+	if (index == 3)
+	{
+		//the low nibble of F is hard wired to 0
+		this->registers.AF.high = value >> 8;
+		this->writeFlags(value & 0xF0);
 	}
-	if (!instructionCaught)
+	else
+		this->writePair(index, value);
+}
+// PUSH rr Length: 1 Cycles 16 Opcode: 0xC5/0xD5/0xE5/0xF5 Flags: ----
+void CPU::opPush(uint8_t opCode)
+{
+	uint8_t index = (opCode >> 4) & 0x3;
+	if (index == 3)
+		this->pushWord((this->registers.AF.high << 8) | this->readFlags());
+	else
+		this->pushWord(this->readPair(index));
+}
+// JP a16 Length: 3 Cycles 16 Opcode: 0xC3 Flags: ----
+void CPU::opJp(uint8_t)
+{
+	this->registers.PC = this->fetchWord();
+}
+// JP cc, a16 Length: 3 Cycles 16/12 Opcode: 0xC2/0xCA/0xD2/0xDA Flags: ----
+void CPU::opJpConditional(uint8_t opCode)
+{
+	uint16_t addr = this->fetchWord();
+	if (this->branchTaken(opCode))
+		this->registers.PC = addr;
+}
+// JP (HL) Length: 1 Cycles 4 Opcode: 0xE9 Flags: ----
+void CPU::opJpHL(uint8_t)
+{
+	this->registers.PC = this->registers.HL.pair;
+}
+// CALL a16 Length: 3 Cycles 24 Opcode: 0xCD Flags: ----
+void CPU::opCall(uint8_t)
+{
+	uint16_t addr = this->fetchWord();
+	this->pushWord(this->registers.PC);
+	this->registers.PC = addr;
+}
+// CALL cc, a16 Length: 3 Cycles 24/12 Opcode: 0xC4/0xCC/0xD4/0xDC Flags: ----
+void CPU::opCallConditional(uint8_t opCode)
+{
+	uint16_t addr = this->fetchWord();
+	if (this->branchTaken(opCode))
 	{
-		cout << "instrution unsupported opcode" << endl;
+		this->pushWord(this->registers.PC);
+		this->registers.PC = addr;
 	}
-	return instructionCaught;
-}
\ No newline at end of file
+}
+// RST n Length: 1 Cycles 16 Opcode: 0xC7-0xFF Flags: ----
+void CPU::opRst(uint8_t opCode)
+{
+	this->pushWord(this->registers.PC);
+	this->registers.PC = opCode & 0x38;
+}
+// PREFIX CB Length: 1 Cycles 4 Opcode: 0xCB Flags: ----
+void CPU::opPrefixCB(uint8_t)
+{
+	uint8_t cbOpCode = this->fetchByte();
+	(this->*cbTable[cbOpCode])(cbOpCode);
+}
+// LDH (a8), A Length: 2 Cycles 12 Opcode: 0xE0 Flags: ----
+void CPU::opLdhAddressA(uint8_t)
+{
+	this->memory->write(0xFF00 | this->fetchByte(), this->registers.AF.high);
+}
+// LDH A, (a8) Length: 2 Cycles 12 Opcode: 0xF0 Flags: ----
+void CPU::opLdhAAddress(uint8_t)
+{
+	this->registers.AF.high = this->memory->read(0xFF00 | this->fetchByte());
+}
+// LD (C), A Length: 1 Cycles 8 Opcode: 0xE2 Flags: ----
+void CPU::opLdhCA(uint8_t)
+{
+	this->memory->write(0xFF00 | this->registers.BC.low, this->registers.AF.high);
+}
+// LD A, (C) Length: 1 Cycles 8 Opcode: 0xF2 Flags: ----
+void CPU::opLdhAC(uint8_t)
+{
+	this->registers.AF.high = this->memory->read(0xFF00 | this->registers.BC.low);
+}
+// LD (a16), A Length: 3 Cycles 16 Opcode: 0xEA Flags: ----
+void CPU::opLdAddressA(uint8_t)
+{
+	this->memory->write(this->fetchWord(), this->registers.AF.high);
+}
+// LD A, (a16) Length: 3 Cycles 16 Opcode: 0xFA Flags: ----
+void CPU::opLdAAddress(uint8_t)
+{
+	this->registers.AF.high = this->memory->read(this->fetchWord());
+}
+// ADD SP, r8 Length: 2 Cycles 16 Opcode: 0xE8 Flags: 00HC
+void CPU::opAddSPImmediate(uint8_t)
+{
+	uint8_t offset = this->fetchByte();
+	uint16_t sp = this->registers.SP;
+	this->registers.SP = sp + (int8_t)offset;
+	this->setFlags(false, false, ((sp & 0xF) + (offset & 0xF)) > 0xF, ((sp & 0xFF) + offset) > 0xFF);
+}
+// LD HL, SP+r8 Length: 2 Cycles 12 Opcode: 0xF8 Flags: 00HC
+void CPU::opLdHLSPImmediate(uint8_t)
+{
+	uint8_t offset = this->fetchByte();
+	uint16_t sp = this->registers.SP;
+	this->registers.HL.pair = sp + (int8_t)offset;
+	this->setFlags(false, false, ((sp & 0xF) + (offset & 0xF)) > 0xF, ((sp & 0xFF) + offset) > 0xFF);
+}
+// LD SP, HL Length: 1 Cycles 8 Opcode: 0xF9 Flags: ----
+void CPU::opLdSPHL(uint8_t)
+{
+	this->registers.SP = this->registers.HL.pair;
+}
+// DI Length: 1 Cycles 4 Opcode: 0xF3 Flags: ----
+void CPU::opDi(uint8_t)
+{
+	this->setInteruptStatus(false);
+}
+// EI Length: 1 Cycles 4 Opcode: 0xFB Flags: ----
+void CPU::opEi(uint8_t)
+{
+	this->setInteruptStatus(true);
+}
+// 0xD3, 0xDB, 0xDD, 0xE3, 0xE4, 0xEB, 0xEC, 0xED, 0xF4, 0xFC, 0xFD lock up the processor
+void CPU::opIllegal(uint8_t)
+{
+	this->setCpuState(LOCKED);
+}
+
+//CB prefixed opcode handlers
+// RLC/RRC/RL/RR/SLA/SRA/SWAP/SRL r Length: 2 Cycles 8 (16 for (HL)) Opcode: 0x00-0x3F Flags: Z00C
+template<ShiftOperation OP, Operand R> void CPU::cbRotateShift(uint8_t)
+{
+	this->writeOperand<R>(this->rotateShift<OP>(this->readOperand<R>()));
+}
+// BIT b, r Length: 2 Cycles 8 (12 for (HL)) Opcode: 0x40-0x7F Flags: Z01-
+template<int BIT, Operand R> void CPU::cbBit(uint8_t)
+{
+	this->setFlags((this->readOperand<R>() & (1 << BIT)) == 0, false, true, this->getFlag(FLAG_CARRY));
+}
+// RES b, r Length: 2 Cycles 8 (16 for (HL)) Opcode: 0x80-0xBF Flags: ----
+template<int BIT, Operand R> void CPU::cbRes(uint8_t)
+{
+	this->writeOperand<R>(this->readOperand<R>() & ~(1 << BIT));
+}
+// SET b, r Length: 2 Cycles 8 (16 for (HL)) Opcode: 0xC0-0xFF Flags: ----
+template<int BIT, Operand R> void CPU::cbSet(uint8_t)
+{
+	this->writeOperand<R>(this->readOperand<R>() | (1 << BIT));
+}
+
+//Dispatch tables, indexed directly by opcode
+const uint16_t CPU::postBootIo[31][2] = {
+	{ 0xFF05, 0x00 }, { 0xFF06, 0x00 }, { 0xFF07, 0x00 }, { 0xFF10, 0x80 }, { 0xFF11, 0xBF }, { 0xFF12, 0xF3 },
+	{ 0xFF14, 0xBF }, { 0xFF16, 0x3F }, { 0xFF17, 0x00 }, { 0xFF19, 0xBF }, { 0xFF1A, 0x7F }, { 0xFF1B, 0xFF },
+	{ 0xFF1C, 0x9F }, { 0xFF1E, 0xBF }, { 0xFF20, 0xFF }, { 0xFF21, 0x00 }, { 0xFF22, 0x00 }, { 0xFF23, 0xBF },
+	{ 0xFF24, 0x77 }, { 0xFF25, 0xF3 }, { 0xFF26, 0xF1 }, { 0xFF40, 0x91 }, { 0xFF42, 0x00 }, { 0xFF43, 0x00 },
+	{ 0xFF45, 0x00 }, { 0xFF47, 0xFC }, { 0xFF48, 0xFF }, { 0xFF49, 0xFF }, { 0xFF4A, 0x00 }, { 0xFF4B, 0x00 },
+	{ 0xFFFF, 0x00 }
+};
+const OpHandler CPU::baseTable[256] =
+{
+	/* 0x00 */ &CPU::opNop, &CPU::opLdPairImmediate, &CPU::opStoreAccumulator, &CPU::opIncPair,
+	/* 0x04 */ &CPU::opIncOperand<REG_B>, &CPU::opDecOperand<REG_B>, &CPU::opLdOperandImmediate<REG_B>, &CPU::opRlca,
+	/* 0x08 */ &CPU::opLdAddressSP, &CPU::opAddHLPair, &CPU::opLoadAccumulator, &CPU::opDecPair,
+	/* 0x0C */ &CPU::opIncOperand<REG_C>, &CPU::opDecOperand<REG_C>, &CPU::opLdOperandImmediate<REG_C>, &CPU::opRrca,
+	/* 0x10 */ &CPU::opStop, &CPU::opLdPairImmediate, &CPU::opStoreAccumulator, &CPU::opIncPair,
+	/* 0x14 */ &CPU::opIncOperand<REG_D>, &CPU::opDecOperand<REG_D>, &CPU::opLdOperandImmediate<REG_D>, &CPU::opRla,
+	/* 0x18 */ &CPU::opJr, &CPU::opAddHLPair, &CPU::opLoadAccumulator, &CPU::opDecPair,
+	/* 0x1C */ &CPU::opIncOperand<REG_E>, &CPU::opDecOperand<REG_E>, &CPU::opLdOperandImmediate<REG_E>, &CPU::opRra,
+	/* 0x20 */ &CPU::opJrConditional, &CPU::opLdPairImmediate, &CPU::opStoreAccumulator, &CPU::opIncPair,
+	/* 0x24 */ &CPU::opIncOperand<REG_H>, &CPU::opDecOperand<REG_H>, &CPU::opLdOperandImmediate<REG_H>, &CPU::opDaa,
+	/* 0x28 */ &CPU::opJrConditional, &CPU::opAddHLPair, &CPU::opLoadAccumulator, &CPU::opDecPair,
+	/* 0x2C */ &CPU::opIncOperand<REG_L>, &CPU::opDecOperand<REG_L>, &CPU::opLdOperandImmediate<REG_L>, &CPU::opCpl,
+	/* 0x30 */ &CPU::opJrConditional, &CPU::opLdPairImmediate, &CPU::opStoreAccumulator, &CPU::opIncPair,
+	/* 0x34 */ &CPU::opIncOperand<REG_HL_PTR>, &CPU::opDecOperand<REG_HL_PTR>, &CPU::opLdOperandImmediate<REG_HL_PTR>, &CPU::opScf,
+	/* 0x38 */ &CPU::opJrConditional, &CPU::opAddHLPair, &CPU::opLoadAccumulator, &CPU::opDecPair,
+	/* 0x3C */ &CPU::opIncOperand<REG_A>, &CPU::opDecOperand<REG_A>, &CPU::opLdOperandImmediate<REG_A>, &CPU::opCcf,
+	/* 0x40 */ &CPU::opLdOperandOperand<REG_B, REG_B>, &CPU::opLdOperandOperand<REG_B, REG_C>, &CPU::opLdOperandOperand<REG_B, REG_D>, &CPU::opLdOperandOperand<REG_B, REG_E>,
+	/* 0x44 */ &CPU::opLdOperandOperand<REG_B, REG_H>, &CPU::opLdOperandOperand<REG_B, REG_L>, &CPU::opLdOperandOperand<REG_B, REG_HL_PTR>, &CPU::opLdOperandOperand<REG_B, REG_A>,
+	/* 0x48 */ &CPU::opLdOperandOperand<REG_C, REG_B>, &CPU::opLdOperandOperand<REG_C, REG_C>, &CPU::opLdOperandOperand<REG_C, REG_D>, &CPU::opLdOperandOperand<REG_C, REG_E>,
+	/* 0x4C */ &CPU::opLdOperandOperand<REG_C, REG_H>, &CPU::opLdOperandOperand<REG_C, REG_L>, &CPU::opLdOperandOperand<REG_C, REG_HL_PTR>, &CPU::opLdOperandOperand<REG_C, REG_A>,
+	/* 0x50 */ &CPU::opLdOperandOperand<REG_D, REG_B>, &CPU::opLdOperandOperand<REG_D, REG_C>, &CPU::opLdOperandOperand<REG_D, REG_D>, &CPU::opLdOperandOperand<REG_D, REG_E>,
+	/* 0x54 */ &CPU::opLdOperandOperand<REG_D, REG_H>, &CPU::opLdOperandOperand<REG_D, REG_L>, &CPU::opLdOperandOperand<REG_D, REG_HL_PTR>, &CPU::opLdOperandOperand<REG_D, REG_A>,
+	/* 0x58 */ &CPU::opLdOperandOperand<REG_E, REG_B>, &CPU::opLdOperandOperand<REG_E, REG_C>, &CPU::opLdOperandOperand<REG_E, REG_D>, &CPU::opLdOperandOperand<REG_E, REG_E>,
+	/* 0x5C */ &CPU::opLdOperandOperand<REG_E, REG_H>, &CPU::opLdOperandOperand<REG_E, REG_L>, &CPU::opLdOperandOperand<REG_E, REG_HL_PTR>, &CPU::opLdOperandOperand<REG_E, REG_A>,
+	/* 0x60 */ &CPU::opLdOperandOperand<REG_H, REG_B>, &CPU::opLdOperandOperand<REG_H, REG_C>, &CPU::opLdOperandOperand<REG_H, REG_D>, &CPU::opLdOperandOperand<REG_H, REG_E>,
+	/* 0x64 */ &CPU::opLdOperandOperand<REG_H, REG_H>, &CPU::opLdOperandOperand<REG_H, REG_L>, &CPU::opLdOperandOperand<REG_H, REG_HL_PTR>, &CPU::opLdOperandOperand<REG_H, REG_A>,
+	/* 0x68 */ &CPU::opLdOperandOperand<REG_L, REG_B>, &CPU::opLdOperandOperand<REG_L, REG_C>, &CPU::opLdOperandOperand<REG_L, REG_D>, &CPU::opLdOperandOperand<REG_L, REG_E>,
+	/* 0x6C */ &CPU::opLdOperandOperand<REG_L, REG_H>, &CPU::opLdOperandOperand<REG_L, REG_L>, &CPU::opLdOperandOperand<REG_L, REG_HL_PTR>, &CPU::opLdOperandOperand<REG_L, REG_A>,
+	/* 0x70 */ &CPU::opLdOperandOperand<REG_HL_PTR, REG_B>, &CPU::opLdOperandOperand<REG_HL_PTR, REG_C>, &CPU::opLdOperandOperand<REG_HL_PTR, REG_D>, &CPU::opLdOperandOperand<REG_HL_PTR, REG_E>,
+	/* 0x74 */ &CPU::opLdOperandOperand<REG_HL_PTR, REG_H>, &CPU::opLdOperandOperand<REG_HL_PTR, REG_L>, &CPU::opHalt, &CPU::opLdOperandOperand<REG_HL_PTR, REG_A>,
+	/* 0x78 */ &CPU::opLdOperandOperand<REG_A, REG_B>, &CPU::opLdOperandOperand<REG_A, REG_C>, &CPU::opLdOperandOperand<REG_A, REG_D>, &CPU::opLdOperandOperand<REG_A, REG_E>,
+	/* 0x7C */ &CPU::opLdOperandOperand<REG_A, REG_H>, &CPU::opLdOperandOperand<REG_A, REG_L>, &CPU::opLdOperandOperand<REG_A, REG_HL_PTR>, &CPU::opLdOperandOperand<REG_A, REG_A>,
+	/* 0x80 */ &CPU::opAluOperand<ALU_ADD, REG_B>, &CPU::opAluOperand<ALU_ADD, REG_C>, &CPU::opAluOperand<ALU_ADD, REG_D>, &CPU::opAluOperand<ALU_ADD, REG_E>,
+	/* 0x84 */ &CPU::opAluOperand<ALU_ADD, REG_H>, &CPU::opAluOperand<ALU_ADD, REG_L>, &CPU::opAluOperand<ALU_ADD, REG_HL_PTR>, &CPU::opAluOperand<ALU_ADD, REG_A>,
+	/* 0x88 */ &CPU::opAluOperand<ALU_ADC, REG_B>, &CPU::opAluOperand<ALU_ADC, REG_C>, &CPU::opAluOperand<ALU_ADC, REG_D>, &CPU::opAluOperand<ALU_ADC, REG_E>,
+	/* 0x8C */ &CPU::opAluOperand<ALU_ADC, REG_H>, &CPU::opAluOperand<ALU_ADC, REG_L>, &CPU::opAluOperand<ALU_ADC, REG_HL_PTR>, &CPU::opAluOperand<ALU_ADC, REG_A>,
+	/* 0x90 */ &CPU::opAluOperand<ALU_SUB, REG_B>, &CPU::opAluOperand<ALU_SUB, REG_C>, &CPU::opAluOperand<ALU_SUB, REG_D>, &CPU::opAluOperand<ALU_SUB, REG_E>,
+	/* 0x94 */ &CPU::opAluOperand<ALU_SUB, REG_H>, &CPU::opAluOperand<ALU_SUB, REG_L>, &CPU::opAluOperand<ALU_SUB, REG_HL_PTR>, &CPU::opAluOperand<ALU_SUB, REG_A>,
+	/* 0x98 */ &CPU::opAluOperand<ALU_SBC, REG_B>, &CPU::opAluOperand<ALU_SBC, REG_C>, &CPU::opAluOperand<ALU_SBC, REG_D>, &CPU::opAluOperand<ALU_SBC, REG_E>,
+	/* 0x9C */ &CPU::opAluOperand<ALU_SBC, REG_H>, &CPU::opAluOperand<ALU_SBC, REG_L>, &CPU::opAluOperand<ALU_SBC, REG_HL_PTR>, &CPU::opAluOperand<ALU_SBC, REG_A>,
+	/* 0xA0 */ &CPU::opAluOperand<ALU_AND, REG_B>, &CPU::opAluOperand<ALU_AND, REG_C>, &CPU::opAluOperand<ALU_AND, REG_D>, &CPU::opAluOperand<ALU_AND, REG_E>,
+	/* 0xA4 */ &CPU::opAluOperand<ALU_AND, REG_H>, &CPU::opAluOperand<ALU_AND, REG_L>, &CPU::opAluOperand<ALU_AND, REG_HL_PTR>, &CPU::opAluOperand<ALU_AND, REG_A>,
+	/* 0xA8 */ &CPU::opAluOperand<ALU_XOR, REG_B>, &CPU::opAluOperand<ALU_XOR, REG_C>, &CPU::opAluOperand<ALU_XOR, REG_D>, &CPU::opAluOperand<ALU_XOR, REG_E>,
+	/* 0xAC */ &CPU::opAluOperand<ALU_XOR, REG_H>, &CPU::opAluOperand<ALU_XOR, REG_L>, &CPU::opAluOperand<ALU_XOR, REG_HL_PTR>, &CPU::opAluOperand<ALU_XOR, REG_A>,
+	/* 0xB0 */ &CPU::opAluOperand<ALU_OR, REG_B>, &CPU::opAluOperand<ALU_OR, REG_C>, &CPU::opAluOperand<ALU_OR, REG_D>, &CPU::opAluOperand<ALU_OR, REG_E>,
+	/* 0xB4 */ &CPU::opAluOperand<ALU_OR, REG_H>, &CPU::opAluOperand<ALU_OR, REG_L>, &CPU::opAluOperand<ALU_OR, REG_HL_PTR>, &CPU::opAluOperand<ALU_OR, REG_A>,
+	/* 0xB8 */ &CPU::opAluOperand<ALU_CP, REG_B>, &CPU::opAluOperand<ALU_CP, REG_C>, &CPU::opAluOperand<ALU_CP, REG_D>, &CPU::opAluOperand<ALU_CP, REG_E>,
+	/* 0xBC */ &CPU::opAluOperand<ALU_CP, REG_H>, &CPU::opAluOperand<ALU_CP, REG_L>, &CPU::opAluOperand<ALU_CP, REG_HL_PTR>, &CPU::opAluOperand<ALU_CP, REG_A>,
+	/* 0xC0 */ &CPU::opRetConditional, &CPU::opPop, &CPU::opJpConditional, &CPU::opJp,
+	/* 0xC4 */ &CPU::opCallConditional, &CPU::opPush, &CPU::opAluImmediate<ALU_ADD>, &CPU::opRst,
+	/* 0xC8 */ &CPU::opRetConditional, &CPU::opRet, &CPU::opJpConditional, &CPU::opPrefixCB,
+	/* 0xCC */ &CPU::opCallConditional, &CPU::opCall, &CPU::opAluImmediate<ALU_ADC>, &CPU::opRst,
+	/* 0xD0 */ &CPU::opRetConditional, &CPU::opPop, &CPU::opJpConditional, &CPU::opIllegal,
+	/* 0xD4 */ &CPU::opCallConditional, &CPU::opPush, &CPU::opAluImmediate<ALU_SUB>, &CPU::opRst,
+	/* 0xD8 */ &CPU::opRetConditional, &CPU::opReti, &CPU::opJpConditional, &CPU::opIllegal,
+	/* 0xDC */ &CPU::opCallConditional, &CPU::opIllegal, &CPU::opAluImmediate<ALU_SBC>, &CPU::opRst,
+	/* 0xE0 */ &CPU::opLdhAddressA, &CPU::opPop, &CPU::opLdhCA, &CPU::opIllegal,
+	/* 0xE4 */ &CPU::opIllegal, &CPU::opPush, &CPU::opAluImmediate<ALU_AND>, &CPU::opRst,
+	/* 0xE8 */ &CPU::opAddSPImmediate, &CPU::opJpHL, &CPU::opLdAddressA, &CPU::opIllegal,
+	/* 0xEC */ &CPU::opIllegal, &CPU::opIllegal, &CPU::opAluImmediate<ALU_XOR>, &CPU::opRst,
+	/* 0xF0 */ &CPU::opLdhAAddress, &CPU::opPop, &CPU::opLdhAC, &CPU::opDi,
+	/* 0xF4 */ &CPU::opIllegal, &CPU::opPush, &CPU::opAluImmediate<ALU_OR>, &CPU::opRst,
+	/* 0xF8 */ &CPU::opLdHLSPImmediate, &CPU::opLdSPHL, &CPU::opLdAAddress, &CPU::opEi,
+	/* 0xFC */ &CPU::opIllegal, &CPU::opIllegal, &CPU::opAluImmediate<ALU_CP>, &CPU::opRst
+};
+const OpHandler CPU::cbTable[256] =
+{
+	/* 0x00 */ &CPU::cbRotateShift<SHIFT_RLC, REG_B>, &CPU::cbRotateShift<SHIFT_RLC, REG_C>, &CPU::cbRotateShift<SHIFT_RLC, REG_D>, &CPU::cbRotateShift<SHIFT_RLC, REG_E>,
+	/* 0x04 */ &CPU::cbRotateShift<SHIFT_RLC, REG_H>, &CPU::cbRotateShift<SHIFT_RLC, REG_L>, &CPU::cbRotateShift<SHIFT_RLC, REG_HL_PTR>, &CPU::cbRotateShift<SHIFT_RLC, REG_A>,
+	/* 0x08 */ &CPU::cbRotateShift<SHIFT_RRC, REG_B>, &CPU::cbRotateShift<SHIFT_RRC, REG_C>, &CPU::cbRotateShift<SHIFT_RRC, REG_D>, &CPU::cbRotateShift<SHIFT_RRC, REG_E>,
+	/* 0x0C */ &CPU::cbRotateShift<SHIFT_RRC, REG_H>, &CPU::cbRotateShift<SHIFT_RRC, REG_L>, &CPU::cbRotateShift<SHIFT_RRC, REG_HL_PTR>, &CPU::cbRotateShift<SHIFT_RRC, REG_A>,
+	/* 0x10 */ &CPU::cbRotateShift<SHIFT_RL, REG_B>, &CPU::cbRotateShift<SHIFT_RL, REG_C>, &CPU::cbRotateShift<SHIFT_RL, REG_D>, &CPU::cbRotateShift<SHIFT_RL, REG_E>,
+	/* 0x14 */ &CPU::cbRotateShift<SHIFT_RL, REG_H>, &CPU::cbRotateShift<SHIFT_RL, REG_L>, &CPU::cbRotateShift<SHIFT_RL, REG_HL_PTR>, &CPU::cbRotateShift<SHIFT_RL, REG_A>,
+	/* 0x18 */ &CPU::cbRotateShift<SHIFT_RR, REG_B>, &CPU::cbRotateShift<SHIFT_RR, REG_C>, &CPU::cbRotateShift<SHIFT_RR, REG_D>, &CPU::cbRotateShift<SHIFT_RR, REG_E>,
+	/* 0x1C */ &CPU::cbRotateShift<SHIFT_RR, REG_H>, &CPU::cbRotateShift<SHIFT_RR, REG_L>, &CPU::cbRotateShift<SHIFT_RR, REG_HL_PTR>, &CPU::cbRotateShift<SHIFT_RR, REG_A>,
+	/* 0x20 */ &CPU::cbRotateShift<SHIFT_SLA, REG_B>, &CPU::cbRotateShift<SHIFT_SLA, REG_C>, &CPU::cbRotateShift<SHIFT_SLA, REG_D>, &CPU::cbRotateShift<SHIFT_SLA, REG_E>,
+	/* 0x24 */ &CPU::cbRotateShift<SHIFT_SLA, REG_H>, &CPU::cbRotateShift<SHIFT_SLA, REG_L>, &CPU::cbRotateShift<SHIFT_SLA, REG_HL_PTR>, &CPU::cbRotateShift<SHIFT_SLA, REG_A>,
+	/* 0x28 */ &CPU::cbRotateShift<SHIFT_SRA, REG_B>, &CPU::cbRotateShift<SHIFT_SRA, REG_C>, &CPU::cbRotateShift<SHIFT_SRA, REG_D>, &CPU::cbRotateShift<SHIFT_SRA, REG_E>,
+	/* 0x2C */ &CPU::cbRotateShift<SHIFT_SRA, REG_H>, &CPU::cbRotateShift<SHIFT_SRA, REG_L>, &CPU::cbRotateShift<SHIFT_SRA, REG_HL_PTR>, &CPU::cbRotateShift<SHIFT_SRA, REG_A>,
+	/* 0x30 */ &CPU::cbRotateShift<SHIFT_SWAP, REG_B>, &CPU::cbRotateShift<SHIFT_SWAP, REG_C>, &CPU::cbRotateShift<SHIFT_SWAP, REG_D>, &CPU::cbRotateShift<SHIFT_SWAP, REG_E>,
+	/* 0x34 */ &CPU::cbRotateShift<SHIFT_SWAP, REG_H>, &CPU::cbRotateShift<SHIFT_SWAP, REG_L>, &CPU::cbRotateShift<SHIFT_SWAP, REG_HL_PTR>, &CPU::cbRotateShift<SHIFT_SWAP, REG_A>,
+	/* 0x38 */ &CPU::cbRotateShift<SHIFT_SRL, REG_B>, &CPU::cbRotateShift<SHIFT_SRL, REG_C>, &CPU::cbRotateShift<SHIFT_SRL, REG_D>, &CPU::cbRotateShift<SHIFT_SRL, REG_E>,
+	/* 0x3C */ &CPU::cbRotateShift<SHIFT_SRL, REG_H>, &CPU::cbRotateShift<SHIFT_SRL, REG_L>, &CPU::cbRotateShift<SHIFT_SRL, REG_HL_PTR>, &CPU::cbRotateShift<SHIFT_SRL, REG_A>,
+	/* 0x40 */ &CPU::cbBit<0, REG_B>, &CPU::cbBit<0, REG_C>, &CPU::cbBit<0, REG_D>, &CPU::cbBit<0, REG_E>,
+	/* 0x44 */ &CPU::cbBit<0, REG_H>, &CPU::cbBit<0, REG_L>, &CPU::cbBit<0, REG_HL_PTR>, &CPU::cbBit<0, REG_A>,
+	/* 0x48 */ &CPU::cbBit<1, REG_B>, &CPU::cbBit<1, REG_C>, &CPU::cbBit<1, REG_D>, &CPU::cbBit<1, REG_E>,
+	/* 0x4C */ &CPU::cbBit<1, REG_H>, &CPU::cbBit<1, REG_L>, &CPU::cbBit<1, REG_HL_PTR>, &CPU::cbBit<1, REG_A>,
+	/* 0x50 */ &CPU::cbBit<2, REG_B>, &CPU::cbBit<2, REG_C>, &CPU::cbBit<2, REG_D>, &CPU::cbBit<2, REG_E>,
+	/* 0x54 */ &CPU::cbBit<2, REG_H>, &CPU::cbBit<2, REG_L>, &CPU::cbBit<2, REG_HL_PTR>, &CPU::cbBit<2, REG_A>,
+	/* 0x58 */ &CPU::cbBit<3, REG_B>, &CPU::cbBit<3, REG_C>, &CPU::cbBit<3, REG_D>, &CPU::cbBit<3, REG_E>,
+	/* 0x5C */ &CPU::cbBit<3, REG_H>, &CPU::cbBit<3, REG_L>, &CPU::cbBit<3, REG_HL_PTR>, &CPU::cbBit<3, REG_A>,
+	/* 0x60 */ &CPU::cbBit<4, REG_B>, &CPU::cbBit<4, REG_C>, &CPU::cbBit<4, REG_D>, &CPU::cbBit<4, REG_E>,
+	/* 0x64 */ &CPU::cbBit<4, REG_H>, &CPU::cbBit<4, REG_L>, &CPU::cbBit<4, REG_HL_PTR>, &CPU::cbBit<4, REG_A>,
+	/* 0x68 */ &CPU::cbBit<5, REG_B>, &CPU::cbBit<5, REG_C>, &CPU::cbBit<5, REG_D>, &CPU::cbBit<5, REG_E>,
+	/* 0x6C */ &CPU::cbBit<5, REG_H>, &CPU::cbBit<5, REG_L>, &CPU::cbBit<5, REG_HL_PTR>, &CPU::cbBit<5, REG_A>,
+	/* 0x70 */ &CPU::cbBit<6, REG_B>, &CPU::cbBit<6, REG_C>, &CPU::cbBit<6, REG_D>, &CPU::cbBit<6, REG_E>,
+	/* 0x74 */ &CPU::cbBit<6, REG_H>, &CPU::cbBit<6, REG_L>, &CPU::cbBit<6, REG_HL_PTR>, &CPU::cbBit<6, REG_A>,
+	/* 0x78 */ &CPU::cbBit<7, REG_B>, &CPU::cbBit<7, REG_C>, &CPU::cbBit<7, REG_D>, &CPU::cbBit<7, REG_E>,
+	/* 0x7C */ &CPU::cbBit<7, REG_H>, &CPU::cbBit<7, REG_L>, &CPU::cbBit<7, REG_HL_PTR>, &CPU::cbBit<7, REG_A>,
+	/* 0x80 */ &CPU::cbRes<0, REG_B>, &CPU::cbRes<0, REG_C>, &CPU::cbRes<0, REG_D>, &CPU::cbRes<0, REG_E>,
+	/* 0x84 */ &CPU::cbRes<0, REG_H>, &CPU::cbRes<0, REG_L>, &CPU::cbRes<0, REG_HL_PTR>, &CPU::cbRes<0, REG_A>,
+	/* 0x88 */ &CPU::cbRes<1, REG_B>, &CPU::cbRes<1, REG_C>, &CPU::cbRes<1, REG_D>, &CPU::cbRes<1, REG_E>,
+	/* 0x8C */ &CPU::cbRes<1, REG_H>, &CPU::cbRes<1, REG_L>, &CPU::cbRes<1, REG_HL_PTR>, &CPU::cbRes<1, REG_A>,
+	/* 0x90 */ &CPU::cbRes<2, REG_B>, &CPU::cbRes<2, REG_C>, &CPU::cbRes<2, REG_D>, &CPU::cbRes<2, REG_E>,
+	/* 0x94 */ &CPU::cbRes<2, REG_H>, &CPU::cbRes<2, REG_L>, &CPU::cbRes<2, REG_HL_PTR>, &CPU::cbRes<2, REG_A>,
+	/* 0x98 */ &CPU::cbRes<3, REG_B>, &CPU::cbRes<3, REG_C>, &CPU::cbRes<3, REG_D>, &CPU::cbRes<3, REG_E>,
+	/* 0x9C */ &CPU::cbRes<3, REG_H>, &CPU::cbRes<3, REG_L>, &CPU::cbRes<3, REG_HL_PTR>, &CPU::cbRes<3, REG_A>,
+	/* 0xA0 */ &CPU::cbRes<4, REG_B>, &CPU::cbRes<4, REG_C>, &CPU::cbRes<4, REG_D>, &CPU::cbRes<4, REG_E>,
+	/* 0xA4 */ &CPU::cbRes<4, REG_H>, &CPU::cbRes<4, REG_L>, &CPU::cbRes<4, REG_HL_PTR>, &CPU::cbRes<4, REG_A>,
+	/* 0xA8 */ &CPU::cbRes<5, REG_B>, &CPU::cbRes<5, REG_C>, &CPU::cbRes<5, REG_D>, &CPU::cbRes<5, REG_E>,
+	/* 0xAC */ &CPU::cbRes<5, REG_H>, &CPU::cbRes<5, REG_L>, &CPU::cbRes<5, REG_HL_PTR>, &CPU::cbRes<5, REG_A>,
+	/* 0xB0 */ &CPU::cbRes<6, REG_B>, &CPU::cbRes<6, REG_C>, &CPU::cbRes<6, REG_D>, &CPU::cbRes<6, REG_E>,
+	/* 0xB4 */ &CPU::cbRes<6, REG_H>, &CPU::cbRes<6, REG_L>, &CPU::cbRes<6, REG_HL_PTR>, &CPU::cbRes<6, REG_A>,
+	/* 0xB8 */ &CPU::cbRes<7, REG_B>, &CPU::cbRes<7, REG_C>, &CPU::cbRes<7, REG_D>, &CPU::cbRes<7, REG_E>,
+	/* 0xBC */ &CPU::cbRes<7, REG_H>, &CPU::cbRes<7, REG_L>, &CPU::cbRes<7, REG_HL_PTR>, &CPU::cbRes<7, REG_A>,
+	/* 0xC0 */ &CPU::cbSet<0, REG_B>, &CPU::cbSet<0, REG_C>, &CPU::cbSet<0, REG_D>, &CPU::cbSet<0, REG_E>,
+	/* 0xC4 */ &CPU::cbSet<0, REG_H>, &CPU::cbSet<0, REG_L>, &CPU::cbSet<0, REG_HL_PTR>, &CPU::cbSet<0, REG_A>,
+	/* 0xC8 */ &CPU::cbSet<1, REG_B>, &CPU::cbSet<1, REG_C>, &CPU::cbSet<1, REG_D>, &CPU::cbSet<1, REG_E>,
+	/* 0xCC */ &CPU::cbSet<1, REG_H>, &CPU::cbSet<1, REG_L>, &CPU::cbSet<1, REG_HL_PTR>, &CPU::cbSet<1, REG_A>,
+	/* 0xD0 */ &CPU::cbSet<2, REG_B>, &CPU::cbSet<2, REG_C>, &CPU::cbSet<2, REG_D>, &CPU::cbSet<2, REG_E>,
+	/* 0xD4 */ &CPU::cbSet<2, REG_H>, &CPU::cbSet<2, REG_L>, &CPU::cbSet<2, REG_HL_PTR>, &CPU::cbSet<2, REG_A>,
+	/* 0xD8 */ &CPU::cbSet<3, REG_B>, &CPU::cbSet<3, REG_C>, &CPU::cbSet<3, REG_D>, &CPU::cbSet<3, REG_E>,
+	/* 0xDC */ &CPU::cbSet<3, REG_H>, &CPU::cbSet<3, REG_L>, &CPU::cbSet<3, REG_HL_PTR>, &CPU::cbSet<3, REG_A>,
+	/* 0xE0 */ &CPU::cbSet<4, REG_B>, &CPU::cbSet<4, REG_C>, &CPU::cbSet<4, REG_D>, &CPU::cbSet<4, REG_E>,
+	/* 0xE4 */ &CPU::cbSet<4, REG_H>, &CPU::cbSet<4, REG_L>, &CPU::cbSet<4, REG_HL_PTR>, &CPU::cbSet<4, REG_A>,
+	/* 0xE8 */ &CPU::cbSet<5, REG_B>, &CPU::cbSet<5, REG_C>, &CPU::cbSet<5, REG_D>, &CPU::cbSet<5, REG_E>,
+	/* 0xEC */ &CPU::cbSet<5, REG_H>, &CPU::cbSet<5, REG_L>, &CPU::cbSet<5, REG_HL_PTR>, &CPU::cbSet<5, REG_A>,
+	/* 0xF0 */ &CPU::cbSet<6, REG_B>, &CPU::cbSet<6, REG_C>, &CPU::cbSet<6, REG_D>, &CPU::cbSet<6, REG_E>,
+	/* 0xF4 */ &CPU::cbSet<6, REG_H>, &CPU::cbSet<6, REG_L>, &CPU::cbSet<6, REG_HL_PTR>, &CPU::cbSet<6, REG_A>,
+	/* 0xF8 */ &CPU::cbSet<7, REG_B>, &CPU::cbSet<7, REG_C>, &CPU::cbSet<7, REG_D>, &CPU::cbSet<7, REG_E>,
+	/* 0xFC */ &CPU::cbSet<7, REG_H>, &CPU::cbSet<7, REG_L>, &CPU::cbSet<7, REG_HL_PTR>, &CPU::cbSet<7, REG_A>
+};
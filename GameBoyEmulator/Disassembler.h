@@ -0,0 +1,83 @@
+#pragma once
+#include "Memory.h"
+#include "OpcodeInfo.h"
+#include <cstdint>
+#include <cstdio>
+using namespace std;
+
+//Turns opcodes back into text using the mnemonics in OpcodeInfo, writing into caller owned buffers
+class Disassembler
+{
+//Attributes
+private:
+	Memory* memory;
+//Member Functions
+public:
+	Disassembler(Memory* memPtr);
+	int disassemble(uint16_t address, char* out, size_t size);
+	static int format(const uint8_t* bytes, uint16_t address, char* out, size_t size);
+};
+
+Disassembler::Disassembler(Memory* memPtr)
+{
+	this->memory = memPtr;
+}
+//disassembles the instruction at address, returns its length in bytes
+int Disassembler::disassemble(uint16_t address, char* out, size_t size)
+{
+	uint8_t bytes[3];
+	for (int i = 0; i < 3; i++)
+	{
+		bytes[i] = this->memory->read(address + i);
+	}
+	return Disassembler::format(bytes, address, out, size);
+}
+//bytes holds the opcode followed by its operands (the CB opcode for prefixed instructions),
+//address is only used to resolve JR targets. Returns the instruction length in bytes
+int Disassembler::format(const uint8_t* bytes, uint16_t address, char* out, size_t size)
+{
+	const OpcodeInfo &info = bytes[0] == 0xCB ? cbOpcodes[bytes[1]] : baseOpcodes[bytes[0]];
+	const char* mnemonic = info.mnemonic;
+	uint16_t word = bytes[1] | (bytes[2] << 8);
+	size_t used = 0;
+	while (*mnemonic != '\0' && used + 1 < size)
+	{
+		int written = 0;
+		if ((mnemonic[0] == 'd' || mnemonic[0] == 'a') && mnemonic[1] == '1' && mnemonic[2] == '6')
+		{
+			written = snprintf(out + used, size - used, "$%04X", word);
+			mnemonic += 3;
+		}
+		else if (mnemonic[0] == 'd' && mnemonic[1] == '8')
+		{
+			written = snprintf(out + used, size - used, "$%02X", bytes[1]);
+			mnemonic += 2;
+		}
+		else if (mnemonic[0] == 'a' && mnemonic[1] == '8')
+		{
+			written = snprintf(out + used, size - used, "$FF%02X", bytes[1]);
+			mnemonic += 2;
+		}
+		else if (mnemonic[0] == 'r' && mnemonic[1] == '8')
+		{
+			//JR shows where it goes, ADD SP/LD HL, SP+ show the offset
+			if (info.properties & OPCODE_ENDS_BLOCK)
+				written = snprintf(out + used, size - used, "$%04X", (uint16_t)(address + 2 + (int8_t)bytes[1]));
+			else
+				written = snprintf(out + used, size - used, "%d", (int8_t)bytes[1]);
+			mnemonic += 2;
+		}
+		else
+		{
+			out[used] = *mnemonic;
+			written = 1;
+			mnemonic++;
+		}
+		used += written;
+		if (used >= size)
+			used = size - 1;
+	}
+	if (size > 0)
+		out[used] = '\0';
+	return info.length;
+}
@@ -2,26 +2,67 @@
 //
 
 #include "pch.h"
-#include <fstream>
 #include "CPU.h"
 #include "Memory.h"
+#include "Timer.h"
+#include "Serial.h"
+#include "PPU.h"
+#include "SaveFile.h"
+#include <iostream>
+#include <cstring>
 using namespace std;
 
-int main()
+//runs the machine with the PPU drawing through Renderer, false when it stopped because the CPU locked up
+template<class Renderer>
+bool run(Memory &memory, bool skipBootRom, bool headless)
 {
-	//open rom file
-	fstream romFile, bootRom;
+	CPU cpu(&memory);
+	Timer timer(&memory, cpu.getScheduler());
+	Serial serial(&memory, cpu.getScheduler());
+	BasicPPU<Renderer> ppu(&memory, cpu.getScheduler());
+	ppu.setHeadless(headless);
+	//battery RAM, written back in the background as the game saves
+	SaveFile save(&memory, cpu.getScheduler(), "ROM.sav");
+	if (skipBootRom || !memory.hasBootRom())
+		cpu.skipBootRom();
 
-	romFile.open("ROM.gb", ios::in | ios::binary);
-
-	bootRom.open("bootRom.bin", ios::in | ios::binary);
+	cpu.stepCPU();
+	return cpu.getCpuState() != LOCKED;
+}
 
-	Memory memory(romFile, bootRom);
-	romFile.close();
+int main(int argc, char* argv[])
+{
+	//--skip-boot-rom starts straight at the cartridge instead of running the boot ROM first
+	//--accurate-ppu draws with the pixel FIFO, for games that change PPU registers in the middle of a line
+	//--headless keeps the LCD timing and interrupts but draws no frames
+	bool skipBootRom = false;
+	bool accuratePpu = false;
+	bool headless = false;
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--skip-boot-rom") == 0)
+			skipBootRom = true;
+		else if (strcmp(argv[i], "--accurate-ppu") == 0)
+			accuratePpu = true;
+		else if (strcmp(argv[i], "--headless") == 0)
+			headless = true;
+	}
 
-	CPU cpu(&memory, 0L);
+	//rom files are mapped, not read
+	Memory memory("ROM.gb", "bootRom.bin");
+	if (!memory.hasRom())
+	{
+		cerr << "Could not open ROM.gb" << endl;
+		return 1;
+	}
 
-	cpu.stepCPU();
+	bool completed = accuratePpu ? run<PixelFifoRenderer>(memory, skipBootRom, headless) : run<ScanlineRenderer>(memory, skipBootRom, headless);
+	if (!completed)
+	{
+		//an illegal opcode (0xD3, 0xDB, ...) locks the CPU up for good
+		cerr << "CPU locked up on an illegal opcode" << endl;
+		return 1;
+	}
 
 	return 0;
 }
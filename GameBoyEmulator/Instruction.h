@@ -1,5 +1,6 @@
 #pragma once
-#include <string>
+#include "OpcodeInfo.h"
+#include <cstdint>
 using namespace std;
 class Instruction
 {
@@ -7,7 +8,6 @@ class Instruction
 public:
 private:
 	uint8_t opCode;
-	string instrucitonMnemonic;
 	short data;
 	short numberOfCyclesLeft;
 //methods
@@ -17,8 +17,7 @@ public:
 	uint8_t getOpCode();
 	void setOpCode(uint8_t opCode);
 
-	string getMnemonic();
-	void setMnemonic(string mnemonic);
+	const char* getMnemonic();
 
 	short getData();
 	void setData(short newData);
@@ -42,11 +41,8 @@ void Instruction::setOpCode(uint8_t opCode)
 	this->opCode = opCode;
 }
 
-string Instruction::getMnemonic()
+//points into the opcode table, nothing is allocated
+const char* Instruction::getMnemonic()
 {
-	return this->instrucitonMnemonic;
-}
-void Instruction::setMnemonic(string mnemonic)
-{
-	this->instrucitonMnemonic = mnemonic;
+	return baseOpcodes[this->opCode].mnemonic;
 }
\ No newline at end of file
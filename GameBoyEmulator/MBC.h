@@ -0,0 +1,182 @@
+#pragma once
+#include <cstdint>
+using namespace std;
+
+//controllers we know how to bank, anything else is run as a plain 32KB cartridge
+enum MbcType { MBC_NONE, MBC_1, MBC_3, MBC_5 };
+
+//Memory bank controller of the cartridge. It only turns writes to the ROM range into bank numbers,
+//Memory points its page table at the banks, so a switch never copies anything.
+class MBC
+{
+	//Attributes
+private:
+	MbcType type = MBC_NONE;
+	int romBankCount = 2, ramBankCount = 0;
+	//as written by the game: MBC1 uses 5+2 bits, MBC3 7 bits and MBC5 8+1 bits
+	int romBankLow = 1, romBankHigh = 0;
+	int ramBank = 0;
+	bool ramEnabled = false;
+	//MBC1 only: the 2 bit register also banks 0000-3FFF and external RAM
+	bool advancedMode = false;
+	//MBC3 clock registers (seconds, minutes, hours, day low, day high) and the latched copy the game reads.
+	//There is no real time source, the clock only changes when the game writes it
+	uint8_t rtc[5] = {}, latchedRtc[5] = {};
+	uint8_t lastLatchWrite = 0xFF;
+	//Methods
+public:
+	MBC();
+	MBC(uint8_t cartridgeType, int romBanks, int ramBanks);
+	void write(uint16_t address, uint8_t value);
+	int getRomBank0();
+	int getRomBankN();
+	int getRamBank();
+	bool isRamEnabled();
+	bool isRtcSelected();
+	uint8_t readRtc();
+	void writeRtc(uint8_t value);
+	static MbcType getType(uint8_t cartridgeType);
+	static bool hasBattery(uint8_t cartridgeType);
+	static int getRamSize(uint8_t ramSizeCode);
+};
+
+MBC::MBC()
+{
+
+}
+//cartridgeType and ramSizeCode come from the header at 0147 and 0149
+MBC::MBC(uint8_t cartridgeType, int romBanks, int ramBanks)
+{
+	this->type = getType(cartridgeType);
+	this->romBankCount = romBanks;
+	this->ramBankCount = ramBanks;
+	//plain cartridges with RAM have it wired up permanently
+	this->ramEnabled = this->type == MBC_NONE;
+}
+MbcType MBC::getType(uint8_t cartridgeType)
+{
+	if (cartridgeType >= 0x01 && cartridgeType <= 0x03)
+		return MBC_1;
+	if (cartridgeType >= 0x0F && cartridgeType <= 0x13)
+		return MBC_3;
+	if (cartridgeType >= 0x19 && cartridgeType <= 0x1E)
+		return MBC_5;
+	return MBC_NONE;
+}
+//external RAM keeps its contents while the game boy is off
+bool MBC::hasBattery(uint8_t cartridgeType)
+{
+	switch (cartridgeType)
+	{
+	case 0x03: case 0x06: case 0x09: case 0x0D: case 0x0F: case 0x10: case 0x13: case 0x1B: case 0x1E: case 0xFF:
+		return true;
+	default:
+		return false;
+	}
+}
+//bytes of external RAM
+int MBC::getRamSize(uint8_t ramSizeCode)
+{
+	switch (ramSizeCode)
+	{
+	case 0x01: return 0x800;
+	case 0x02: return 0x2000;
+	case 0x03: return 0x8000;
+	case 0x04: return 0x20000;
+	case 0x05: return 0x10000;
+	default: return 0;
+	}
+}
+void MBC::write(uint16_t address, uint8_t value)
+{
+	if (this->type == MBC_NONE)
+		return;
+	if (address < 0x2000)
+	{
+		this->ramEnabled = (value & 0x0F) == 0x0A;
+		return;
+	}
+	switch (this->type)
+	{
+	case MBC_1:
+		if (address < 0x4000)
+			this->romBankLow = (value & 0x1F) == 0 ? 1 : (value & 0x1F);
+		else if (address < 0x6000)
+			this->romBankHigh = value & 0x03;
+		else
+			this->advancedMode = (value & 0x01) != 0;
+		break;
+	case MBC_3:
+		if (address < 0x4000)
+			this->romBankLow = (value & 0x7F) == 0 ? 1 : (value & 0x7F);
+		else if (address < 0x6000)
+			this->ramBank = value & 0x0F;
+		else
+		{
+			//writing 0 then 1 copies the clock into the registers the game can read
+			if (this->lastLatchWrite == 0x00 && value == 0x01)
+			{
+				for (int i = 0; i < 5; i++)
+				{
+					this->latchedRtc[i] = this->rtc[i];
+				}
+			}
+			this->lastLatchWrite = value;
+		}
+		break;
+	case MBC_5:
+		if (address < 0x3000)
+			this->romBankLow = value;
+		else if (address < 0x4000)
+			this->romBankHigh = value & 0x01;
+		else if (address < 0x6000)
+			this->ramBank = value & 0x0F;
+		break;
+	default:
+		break;
+	}
+}
+//bank mapped at 0000-3FFF
+int MBC::getRomBank0()
+{
+	if (this->type == MBC_1 && this->advancedMode)
+		return (this->romBankHigh << 5) % this->romBankCount;
+	return 0;
+}
+//bank mapped at 4000-7FFF
+int MBC::getRomBankN()
+{
+	switch (this->type)
+	{
+	case MBC_1: return ((this->romBankHigh << 5) | this->romBankLow) % this->romBankCount;
+	case MBC_3: return this->romBankLow % this->romBankCount;
+	case MBC_5: return ((this->romBankHigh << 8) | this->romBankLow) % this->romBankCount;
+	default: return 1;
+	}
+}
+//bank mapped at A000-BFFF, only meaningful while RAM is enabled and no clock register is selected
+int MBC::getRamBank()
+{
+	if (this->ramBankCount == 0)
+		return 0;
+	if (this->type == MBC_1)
+		return this->advancedMode ? this->romBankHigh % this->ramBankCount : 0;
+	return this->ramBank % this->ramBankCount;
+}
+bool MBC::isRamEnabled()
+{
+	return this->ramEnabled;
+}
+bool MBC::isRtcSelected()
+{
+	return this->type == MBC_3 && this->ramBank >= 0x08 && this->ramBank <= 0x0C;
+}
+uint8_t MBC::readRtc()
+{
+	return this->latchedRtc[this->ramBank - 0x08];
+}
+void MBC::writeRtc(uint8_t value)
+{
+	this->rtc[this->ramBank - 0x08] = value;
+	this->latchedRtc[this->ramBank - 0x08] = value;
+}
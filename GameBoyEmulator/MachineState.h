@@ -0,0 +1,66 @@
+#pragma once
+#include "RegisterFile.h"
+#include "MBC.h"
+#include <cstdint>
+#include <type_traits>
+using namespace std;
+
+//components that run off the master clock, each has at most one pending event
+enum EventType { EVENT_PPU, EVENT_TIMER, EVENT_APU, EVENT_SERIAL, EVENT_SAVE, EVENT_TYPE_COUNT };
+
+//absolute cycle of each type's pending event, the queue built from them is not part of the state
+struct SchedulerState
+{
+	uint64_t deadline[EVENT_TYPE_COUNT];
+};
+
+//see Timer
+struct TimerState
+{
+	//cycle DIV was last reset, the 16 bit divider counts the cycles since
+	uint64_t dividerStart;
+	//TIMA held timaValue at timaTick, counted in TAC periods since dividerStart
+	uint64_t timaTick;
+	uint8_t timaValue, tma, tac;
+};
+
+struct SerialState
+{
+	uint8_t sb, sc;
+};
+
+//see PPU
+struct PpuState
+{
+	//FF40-FF45 and FF47-FF4B, the low 3 bits of stat are the mode and the LY=LYC flag
+	uint8_t lcdc, stat, scy, scx, ly, lyc, bgp, obp0, obp1, wy, wx;
+	//FF46, source page of the last OAM DMA
+	uint8_t dma;
+	//line of the window the next line showing it draws, only counts lines the window was on
+	uint8_t windowLine;
+	//the STAT interrupt is requested when any enabled condition turns this on
+	bool statLine;
+	//cycle the transfer (mode 3) of the current or last visible line started
+	uint64_t transferStart;
+	//frames completed, goes up as each VBlank starts
+	uint64_t frameCount;
+};
+
+//Everything about one emulated game boy that changes while it runs, in a single allocation owned by Memory.
+//The components only keep pointers into it, so a snapshot is one memcpy of Memory::getStateSize() bytes
+//and restoring one is a memcpy followed by rebuilding the lookup structures (page table, event queue).
+struct alignas(64) MachineState
+{
+	RegisterFile registers;
+	SchedulerState scheduler;
+	MBC mbc;
+	TimerState timer;
+	SerialState serial;
+	PpuState ppu;
+	//set by the first write to FF50, the boot ROM stays unmapped from then on
+	bool bootRomDisabled;
+	//8000-FFFF: VRAM, WRAM, OAM, IO and HRAM. The external RAM and echo windows are never stored here
+	alignas(64) uint8_t memory[0x8000];
+	//the cartridge's external RAM follows in the same allocation, see Memory::getExternalRam
+};
+static_assert(is_trivially_copyable<MachineState>::value, "snapshots copy the state as raw bytes");
@@ -0,0 +1,110 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+using namespace std;
+
+//Read-only view of a whole file. The pages come straight from the OS page cache, so opening costs next to
+//nothing and every emulator mapping the same file shares one copy of it.
+class MappedFile
+{
+	//Attributes
+private:
+	const uint8_t* data = nullptr;
+	size_t size = 0;
+#ifdef _WIN32
+	HANDLE mapping = nullptr;
+#endif
+	//Methods
+public:
+	MappedFile();
+	MappedFile(const char* fileName);
+	~MappedFile();
+	MappedFile(const MappedFile &) = delete;
+	MappedFile &operator=(const MappedFile &) = delete;
+	const uint8_t* getData() const;
+	size_t getSize() const;
+};
+
+MappedFile::MappedFile()
+{
+
+}
+//leaves the view empty if the file cannot be opened
+MappedFile::MappedFile(const char* fileName)
+{
+#ifdef _WIN32
+	HANDLE file = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return;
+	LARGE_INTEGER fileSize;
+	if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+	{
+		this->mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (this->mapping != nullptr)
+		{
+			this->data = static_cast<const uint8_t*>(MapViewOfFile(this->mapping, FILE_MAP_READ, 0, 0, 0));
+			if (this->data != nullptr)
+			{
+				this->size = (size_t)fileSize.QuadPart;
+				//fault the whole image in now rather than one page at a time while the game runs
+				WIN32_MEMORY_RANGE_ENTRY range = { (void*)this->data, this->size };
+				PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+			}
+		}
+	}
+	//the mapping keeps the file open
+	CloseHandle(file);
+#else
+	int file = open(fileName, O_RDONLY);
+	if (file < 0)
+		return;
+	struct stat status;
+	if (fstat(file, &status) == 0 && status.st_size > 0)
+	{
+		int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+		//fault the whole image in now rather than one page at a time while the game runs
+		flags |= MAP_POPULATE;
+#endif
+		void* view = mmap(nullptr, (size_t)status.st_size, PROT_READ, flags, file, 0);
+		if (view != MAP_FAILED)
+		{
+			this->data = static_cast<const uint8_t*>(view);
+			this->size = (size_t)status.st_size;
+			madvise(view, this->size, MADV_WILLNEED);
+		}
+	}
+	//the mapping keeps the file open
+	close(file);
+#endif
+}
+MappedFile::~MappedFile()
+{
+	if (this->data == nullptr)
+		return;
+#ifdef _WIN32
+	UnmapViewOfFile(this->data);
+	CloseHandle(this->mapping);
+#else
+	munmap(const_cast<uint8_t*>(this->data), this->size);
+#endif
+}
+//nullptr when the file could not be mapped
+const uint8_t* MappedFile::getData() const
+{
+	return this->data;
+}
+size_t MappedFile::getSize() const
+{
+	return this->size;
+}
@@ -1,96 +1,275 @@
 #pragma once
-#include <fstream>
 #include <iostream>
 #include <cstdint>
+#include <cstring>
+#include "MBC.h"
+#include "MachineState.h"
+#include "RomImage.h"
+#include <memory>
+#include <new>
+#include <algorithm>
+#include <vector>
 using namespace std;
 
+//IF/IE bits, in priority order
+const uint8_t INTERRUPT_VBLANK = 0x01;
+const uint8_t INTERRUPT_LCD_STAT = 0x02;
+const uint8_t INTERRUPT_TIMER = 0x04;
+const uint8_t INTERRUPT_SERIAL = 0x08;
+const uint8_t INTERRUPT_JOYPAD = 0x10;
+
+//hardware registers belong to the component that implements them, it gets the whole address
+typedef uint8_t (*IoReadHandler)(void* component, uint16_t address);
+typedef void (*IoWriteHandler)(void* component, uint16_t address, uint8_t value);
+//for registers that count with the clock: the first cycle the register can read differently
+typedef uint64_t (*IoChangeHandler)(void* component, uint16_t address);
+
+struct IoPort
+{
+	void* component;
+	IoReadHandler read;
+	IoWriteHandler write;
+	IoChangeHandler nextChange;
+};
+
+//told about every write to a range of VRAM or WRAM after it has landed, start-end is what changed
+typedef void (*WriteWatcher)(void* component, uint16_t start, uint16_t end);
+
+struct WriteWatch
+{
+	uint16_t start, end;
+	void* component;
+	WriteWatcher watcher;
+};
+
 class Memory
 {
 	// Attributes
 public:
 private:
-	uint8_t* bootRom;
-	uint8_t* cartridgeRom;
-	uint8_t* mainMemory = new uint8_t[0xFFFF];
+	//shared with every other instance running the same files
+	shared_ptr<const RomImage> romImage, bootRomImage;
+	const uint8_t* bootRom;
+	const uint8_t* cartridgeRom;
+	//the arena, see MachineState
+	MachineState* state = nullptr;
+	size_t stateSize = 0;
+	//state->memory, it starts at mainMemoryStart
+	uint8_t* mainMemory = nullptr;
+	int mainMemoryStart = 0x8000;
 	int cartBank0Start = 0x0000, cartBank0End = 0x3FFF;
 	int cartBank1NStart = 0x4000, cartBank1NEnd = 0x7FFF;
 	//bankStartAddress = bankNumber * 16,384
 	int vRamStart = 0x8000, vRamEnd = 0x9FFF;
 	int exRamStart = 0xA000, exRamEnd = 0xBFFF;
 	int ramStart = 0xC000, ramEnd = 0xDFFF;
+	int echoRamStart = 0xE000, echoRamEnd = 0xFDFF;
 	int oamRamStart = 0xFE00, oamRamEnd = 0xFE9F;
 	int ioRamStart = 0xFF00, ioRamEnd = 0xFF7F;
 	int hRamStart = 0xFF80, hRamEnd = 0xFFFF;
 	int cartSize = 0L;
 	int bootRomSize = 0L;
+	int currentRomBank = 1;
+	//banks the page table currently points at, -1 when external RAM is unmapped
+	int currentRomBank0 = 0;
+	int currentRamBank = -1;
+	uint8_t* externalRam = nullptr;
+	int externalRamSize = 0;
+	bool battery = false;
+	//one flag per 256 byte page of external RAM. A clean page is mapped read only, so the first write
+	//after it was saved goes through writeSlow, which sets the flag and maps the page writable
+	vector<uint8_t> ramDirty;
+	//bumped on every write to the 256 byte page, lets decoded code notice it has been overwritten
+	uint32_t pageVersion[256] = {};
+	//FF00-FF7F then IE, ports nobody mapped read and write plain memory
+	IoPort ioPorts[0x81] = {};
+	//host address of each 256 byte page, nullptr where readSlow/writeSlow have to decide
+	const uint8_t* readPages[256] = {};
+	uint8_t* writePages[256] = {};
+	//pages with a WriteWatch on them, they never get a write pointer
+	bool watchedPages[256] = {};
+	vector<WriteWatch> writeWatches;
 	//Methods
 public:
 	Memory();
-	Memory(fstream &romFile, fstream &bootRom);
+	Memory(const char* romPath, const char* bootRomPath);
+	~Memory();
+	Memory(const Memory &) = delete;
+	Memory &operator=(const Memory &) = delete;
 	uint8_t read(uint16_t address);
 	void write(uint16_t address, uint8_t writeValue);
 
-	uint8_t* getCartRom();
+	const uint8_t* getCartRom();
 	uint8_t* getMainMemory();
 	int getCartRomSize();
+	bool hasRom();
+	int getBankAt(uint16_t address);
+	uint32_t getPageVersion(uint8_t page);
+	void mapIo(uint16_t address, void* component, IoReadHandler read, IoWriteHandler write, IoChangeHandler nextChange = nullptr);
+	void watchWrites(uint16_t start, uint16_t end, void* component, WriteWatcher watcher);
+	uint64_t getNextChange(uint16_t address);
+	void requestInterrupt(uint8_t mask);
+	uint8_t* getExternalRam();
+	int getExternalRamSize();
+	bool hasBattery();
+	bool takeDirtyRamPage(int ramPage);
+	MachineState* getState();
+	size_t getStateSize();
+	void reloadState();
+	bool hasBootRom();
 
 private:
+	void allocateState(int ramSize);
+	void notifyWatchers(uint16_t start, uint16_t end);
+	IoPort* getIoPort(uint16_t address);
+	static uint8_t readBootRomRegister(void* component, uint16_t address);
+	static void writeBootRomRegister(void* component, uint16_t address, uint8_t value);
+	void buildPageTable();
+	void mapPages(int start, int end, const uint8_t* readHost, uint8_t* writeHost);
+	uint8_t readSlow(uint16_t address);
+	void writeSlow(uint16_t address, uint8_t writeValue);
 	void loadInArray(uint8_t* array, int startAddressMemory, int startAAddressArray, int size);
 	void changeCartridgeROMBank(int bankNumber);
+	void changeCartridgeROM0Bank(int bankNumber);
+	void changeCartridgeRAMBank(int bankNumber);
+	uint8_t* getRamPage(int bankNumber, int address);
+	void updateBanks();
 };
 
 
 Memory::Memory()
 {
-
+	this->allocateState(0);
 }
-Memory::Memory(fstream &romFile, fstream &bootRom)
+Memory::Memory(const char* romPath, const char* bootRomPath)
 {
-	//read in romFile
-	romFile.seekg(0L, ios::end);
-	this->cartSize = romFile.tellg();
-	this->cartridgeRom = new uint8_t[this->cartSize];
-	romFile.clear();
-	romFile.seekg(0L, ios::beg);
+	//whole 16KB banks and at least two of them
+	this->romImage = RomImage::load(romPath, 0x4000, 0x8000);
+	this->cartridgeRom = this->romImage->getData();
+	this->cartSize = (int)this->romImage->getFileSize();
+	int romAllocation = (int)this->romImage->getSize();
 
-	uint8_t fileReadIn = 0x00000000;
-	int PCess = 0;
-	while ((romFile.read(reinterpret_cast<char*>(&fileReadIn), sizeof(uint8_t))))
-	{
-		this->cartridgeRom[PCess] = fileReadIn;
-		PCess++;
-	}
-
-	//initialize boot rom
-	bootRom.seekg(0L, ios::end);
-	this->bootRomSize = bootRom.tellg();
-	this->bootRom = new uint8_t[this->bootRomSize];
-	bootRom.clear();
-	bootRom.seekg(0L, ios::beg);
+	//controller and RAM size from the cartridge header
+	this->externalRamSize = MBC::getRamSize(this->cartridgeRom[0x149]);
+	this->allocateState(this->externalRamSize);
+	this->battery = MBC::hasBattery(this->cartridgeRom[0x147]);
+	this->ramDirty.assign(this->externalRamSize / 0x100, 0);
+	this->state->mbc = MBC(this->cartridgeRom[0x147], romAllocation / 0x4000, (this->externalRamSize + 0x1FFF) / 0x2000);
 
-	PCess = 0;
+	this->bootRomImage = RomImage::load(bootRomPath, 0x100, 0x100);
+	this->bootRom = this->bootRomImage->getData();
+	this->bootRomSize = (int)this->bootRomImage->getFileSize();
+	this->mapIo(0xFF50, this, &Memory::readBootRomRegister, &Memory::writeBootRomRegister);
 
-	while ((romFile.read(reinterpret_cast<char*>(&fileReadIn), sizeof(uint8_t))))
-	{
-		this->bootRom[PCess] = fileReadIn;
-		PCess++;
-	}
+	this->buildPageTable();
+}
+Memory::~Memory()
+{
+	this->state->~MachineState();
+	operator delete(this->state, align_val_t(alignof(MachineState)));
+}
+//one zeroed block for the MachineState and ramSize bytes of external RAM right after it
+void Memory::allocateState(int ramSize)
+{
+	this->stateSize = sizeof(MachineState) + ramSize;
+	void* arena = operator new(this->stateSize, align_val_t(alignof(MachineState)));
+	memset(arena, 0, this->stateSize);
+	this->state = new (arena) MachineState();
+	this->mainMemory = this->state->memory;
+	if (ramSize > 0)
+		this->externalRam = reinterpret_cast<uint8_t*>(this->state + 1);
 }
 
 uint8_t Memory::read(uint16_t address)
 {
-	return this->cartridgeRom[address];
+	const uint8_t* page = this->readPages[address >> 8];
+	if (page != nullptr)
+		return page[address & 0xFF];
+	return this->readSlow(address);
 }
 
 void Memory::write(uint16_t address, uint8_t writeValue)
 {
-	this->cartridgeRom[address] = writeValue;
+	uint8_t* page = this->writePages[address >> 8];
+	if (page == nullptr)
+	{
+		this->writeSlow(address, writeValue);
+		return;
+	}
+	page[address & 0xFF] = writeValue;
+	this->pageVersion[address >> 8]++;
 }
 
-uint8_t* Memory::getCartRom()
+//OAM and the unusable area after it, IO and HRAM, echo RAM writes, clean external RAM pages, watched pages, and everything without backing memory
+uint8_t Memory::readSlow(uint16_t address)
+{
+	if (address >= this->ioRamStart)
+	{
+		IoPort* port = this->getIoPort(address);
+		if (port != nullptr && port->read != nullptr)
+			return port->read(port->component, address);
+		return this->mainMemory[address - this->mainMemoryStart];
+	}
+	if (address >= this->oamRamStart && address <= this->oamRamEnd)
+		return this->mainMemory[address - this->mainMemoryStart];
+	if (address >= this->exRamStart && address <= this->exRamEnd && this->state->mbc.isRamEnabled() && this->state->mbc.isRtcSelected())
+		return this->state->mbc.readRtc();
+	return 0xFF;
+}
+void Memory::writeSlow(uint16_t address, uint8_t writeValue)
+{
+	if (this->watchedPages[address >> 8])
+	{
+		this->mainMemory[address - this->mainMemoryStart] = writeValue;
+		this->pageVersion[address >> 8]++;
+		this->notifyWatchers(address, address);
+	}
+	else if (address >= this->ioRamStart)
+	{
+		IoPort* port = this->getIoPort(address);
+		//registers never hold code, so the page version is left alone
+		if (port != nullptr && port->write != nullptr)
+		{
+			port->write(port->component, address, writeValue);
+			return;
+		}
+		this->mainMemory[address - this->mainMemoryStart] = writeValue;
+		this->pageVersion[address >> 8]++;
+	}
+	else if (address >= this->oamRamStart && address <= this->oamRamEnd)
+	{
+		this->mainMemory[address - this->mainMemoryStart] = writeValue;
+		this->pageVersion[address >> 8]++;
+	}
+	else if (address >= this->echoRamStart && address <= this->echoRamEnd)
+		this->write(address - (this->echoRamStart - this->ramStart), writeValue);
+	else if (address >= this->exRamStart && address <= this->exRamEnd)
+	{
+		if (this->state->mbc.isRamEnabled() && this->state->mbc.isRtcSelected())
+			this->state->mbc.writeRtc(writeValue);
+		else if (this->currentRamBank >= 0)
+		{
+			//first write to the page since it was last saved
+			uint8_t* pointer = this->getRamPage(this->currentRamBank, address);
+			this->ramDirty[(pointer - this->externalRam) >> 8] = 1;
+			this->writePages[address >> 8] = pointer;
+			pointer[address & 0xFF] = writeValue;
+			this->pageVersion[address >> 8]++;
+		}
+	}
+	else if (address <= this->cartBank1NEnd)
+	{
+		//writes to ROM are meant for the MBC
+		this->state->mbc.write(address, writeValue);
+		this->updateBanks();
+	}
+}
+
+const uint8_t* Memory::getCartRom()
 {
 	return this->cartridgeRom;
 }
+//8000-FFFF, indexed from 8000
 uint8_t* Memory::getMainMemory()
 {
 	return this->mainMemory;
@@ -99,18 +278,237 @@ int Memory::getCartRomSize()
 {
 	return this->cartSize;
 }
+//false when the cartridge ROM file could not be opened or was empty, the cartridge then reads as all 0xFF
+bool Memory::hasRom()
+{
+	return this->romImage->isLoaded();
+}
+//bank currently mapped at the address, 0 for addresses that are not banked
+int Memory::getBankAt(uint16_t address)
+{
+	if (address <= this->cartBank0End)
+		return this->currentRomBank0;
+	if (address <= this->cartBank1NEnd)
+		return this->currentRomBank;
+	if (address >= this->exRamStart && address <= this->exRamEnd)
+		return this->currentRamBank;
+	return 0;
+}
+uint32_t Memory::getPageVersion(uint8_t page)
+{
+	//echo RAM is only ever written through the WRAM page it mirrors
+	if (page >= (this->echoRamStart >> 8) && page <= (this->echoRamEnd >> 8))
+		page -= (this->echoRamStart - this->ramStart) >> 8;
+	return this->pageVersion[page];
+}
+//hands reads and writes of a hardware register to the component
+void Memory::mapIo(uint16_t address, void* component, IoReadHandler read, IoWriteHandler write, IoChangeHandler nextChange)
+{
+	IoPort* port = this->getIoPort(address);
+	if (port == nullptr)
+		return;
+	port->component = component;
+	port->read = read;
+	port->write = write;
+	port->nextChange = nextChange;
+}
+//cycle from which a read of the address may return something else without anything being written,
+//UINT64_MAX when only a write (by the CPU or a scheduled event) can change it
+uint64_t Memory::getNextChange(uint16_t address)
+{
+	IoPort* port = this->getIoPort(address);
+	if (port == nullptr || port->nextChange == nullptr)
+		return UINT64_MAX;
+	return port->nextChange(port->component, address);
+}
+//sends writes to start-end through writeSlow so the watcher sees each of them. Only for VRAM and WRAM
+void Memory::watchWrites(uint16_t start, uint16_t end, void* component, WriteWatcher watcher)
+{
+	this->writeWatches.push_back({ start, end, component, watcher });
+	for (int page = start >> 8; page <= end >> 8; page++)
+	{
+		this->watchedPages[page] = true;
+		this->writePages[page] = nullptr;
+	}
+}
+void Memory::notifyWatchers(uint16_t start, uint16_t end)
+{
+	for (const WriteWatch &watch : this->writeWatches)
+	{
+		if (start <= watch.end && end >= watch.start)
+			watch.watcher(watch.component, max(start, watch.start), min(end, watch.end));
+	}
+}
+//sets the bit in IF, whoever owns IF decides when it is serviced
+void Memory::requestInterrupt(uint8_t mask)
+{
+	this->write(0xFF0F, this->read(0xFF0F) | mask);
+}
+uint8_t* Memory::getExternalRam()
+{
+	return this->externalRam;
+}
+int Memory::getExternalRamSize()
+{
+	return this->externalRamSize;
+}
+//external RAM is worth saving
+bool Memory::hasBattery()
+{
+	return this->battery;
+}
+//clears the page's dirty flag and maps it read only again, false if nothing was written since the last call
+bool Memory::takeDirtyRamPage(int ramPage)
+{
+	if (!this->ramDirty[ramPage])
+		return false;
+	this->ramDirty[ramPage] = 0;
+	uint8_t* pointer = this->externalRam + ramPage * 0x100;
+	for (int page = this->exRamStart >> 8; page <= this->exRamEnd >> 8; page++)
+	{
+		if (this->writePages[page] == pointer)
+			this->writePages[page] = nullptr;
+	}
+	return true;
+}
+MachineState* Memory::getState()
+{
+	return this->state;
+}
+//bytes from getState() a snapshot has to copy, external RAM included
+size_t Memory::getStateSize()
+{
+	return this->stateSize;
+}
+//the arena was overwritten by a snapshot: every decoded block is stale, the restored RAM has not been
+//saved and the page table has to follow the restored MBC registers
+void Memory::reloadState()
+{
+	for (int page = 0; page < 256; page++)
+	{
+		this->pageVersion[page]++;
+	}
+	fill(this->ramDirty.begin(), this->ramDirty.end(), 1);
+	//memory under a watch changed without a single write
+	for (const WriteWatch &watch : this->writeWatches)
+	{
+		watch.watcher(watch.component, watch.start, watch.end);
+	}
+	this->currentRomBank0 = -1;
+	this->currentRomBank = -1;
+	//not a bank and not the unmapped -1 either, so the window is always remapped
+	this->currentRamBank = -2;
+	this->updateBanks();
+}
+//false when the boot ROM file was missing or empty, there is then nothing to run at 0000
+bool Memory::hasBootRom()
+{
+	return this->bootRomSize > 0;
+}
+uint8_t Memory::readBootRomRegister(void*, uint16_t)
+{
+	return 0xFF;
+}
+//the boot ROM's last instruction writes 1 here and the cartridge's first page shows through
+void Memory::writeBootRomRegister(void* component, uint16_t, uint8_t value)
+{
+	Memory* memory = static_cast<Memory*>(component);
+	if (value == 0 || memory->state->bootRomDisabled)
+		return;
+	memory->state->bootRomDisabled = true;
+	memory->changeCartridgeROM0Bank(memory->currentRomBank0);
+	//blocks decoded from the boot ROM are keyed like the cartridge code now underneath them
+	memory->pageVersion[0]++;
+}
+//ROM, VRAM and WRAM get direct pointers, external RAM only while the MBC has it enabled
+void Memory::buildPageTable()
+{
+	this->changeCartridgeROM0Bank(this->currentRomBank0);
+	this->mapPages(this->cartBank1NStart, this->cartBank1NEnd, this->cartridgeRom + this->currentRomBank * 0x4000, nullptr);
+	this->updateBanks();
+	uint8_t* vRam = this->mainMemory + (this->vRamStart - this->mainMemoryStart);
+	uint8_t* ram = this->mainMemory + (this->ramStart - this->mainMemoryStart);
+	this->mapPages(this->vRamStart, this->vRamEnd, vRam, vRam);
+	this->mapPages(this->ramStart, this->ramEnd, ram, ram);
+	//reads of echo RAM go straight through, writes take the slow path so the WRAM page is the one bumped
+	this->mapPages(this->echoRamStart, this->echoRamEnd, ram, nullptr);
+}
+//points the pages covering start-end at consecutive host memory, a nullptr host sends them to the slow path
+void Memory::mapPages(int start, int end, const uint8_t* readHost, uint8_t* writeHost)
+{
+	for (int page = start >> 8; page <= end >> 8; page++)
+	{
+		int offset = (page << 8) - start;
+		this->readPages[page] = readHost != nullptr ? readHost + offset : nullptr;
+		this->writePages[page] = writeHost != nullptr && !this->watchedPages[page] ? writeHost + offset : nullptr;
+	}
+}
+//nullptr for HRAM
+IoPort* Memory::getIoPort(uint16_t address)
+{
+	if (address == 0xFFFF)
+		return &this->ioPorts[0x80];
+	if (address >= this->ioRamStart && address <= this->ioRamEnd)
+		return &this->ioPorts[address - this->ioRamStart];
+	return nullptr;
+}
 
 
 
+//a bank switch only repoints the pages of its 16KB or 8KB window
 void Memory::changeCartridgeROMBank(int bankNumber)
 {
-
+	this->currentRomBank = bankNumber;
+	this->mapPages(this->cartBank1NStart, this->cartBank1NEnd, this->cartridgeRom + bankNumber * 0x4000, nullptr);
+}
+void Memory::changeCartridgeROM0Bank(int bankNumber)
+{
+	this->currentRomBank0 = bankNumber;
+	this->mapPages(this->cartBank0Start, this->cartBank0End, this->cartridgeRom + bankNumber * 0x4000, nullptr);
+	//the boot ROM covers the first page until FF50 is written
+	if (!this->state->bootRomDisabled && this->bootRomSize > 0)
+		this->mapPages(0x0000, 0x00FF, this->bootRom, nullptr);
+}
+//-1 unmaps external RAM, reads and writes then go to readSlow/writeSlow
+void Memory::changeCartridgeRAMBank(int bankNumber)
+{
+	this->currentRamBank = bankNumber;
+	if (bankNumber < 0)
+	{
+		this->mapPages(this->exRamStart, this->exRamEnd, nullptr, nullptr);
+		return;
+	}
+	for (int address = this->exRamStart; address <= this->exRamEnd; address += 0x100)
+	{
+		uint8_t* pointer = this->getRamPage(bankNumber, address);
+		this->mapPages(address, address + 0xFF, pointer, this->ramDirty[(pointer - this->externalRam) >> 8] ? pointer : nullptr);
+	}
+}
+//host address of the 256 byte page of external RAM the address falls in, 2KB RAM chips repeat across the window
+uint8_t* Memory::getRamPage(int bankNumber, int address)
+{
+	return this->externalRam + (bankNumber * 0x2000 + ((address & 0xFF00) - this->exRamStart)) % this->externalRamSize;
+}
+//brings the page table in line with the MBC registers, touching only windows whose bank changed
+void Memory::updateBanks()
+{
+	int bank0 = this->state->mbc.getRomBank0();
+	if (bank0 != this->currentRomBank0)
+		this->changeCartridgeROM0Bank(bank0);
+	int bankN = this->state->mbc.getRomBankN();
+	if (bankN != this->currentRomBank)
+		this->changeCartridgeROMBank(bankN);
+	int ramBank = -1;
+	if (this->externalRam != nullptr && this->state->mbc.isRamEnabled() && !this->state->mbc.isRtcSelected())
+		ramBank = this->state->mbc.getRamBank();
+	if (ramBank != this->currentRamBank)
+		this->changeCartridgeRAMBank(ramBank);
 }
 void Memory::loadInArray(uint8_t* array, int startAddressMemory, int startAAddressArray, int size)
 {
 	int j = startAAddressArray;
 	for (int i = startAddressMemory; i < size; i++, j++)
 	{
-		this->mainMemory[i] = array[j];
+		this->mainMemory[i - this->mainMemoryStart] = array[j];
 	}
 }
\ No newline at end of file
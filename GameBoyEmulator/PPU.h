@@ -1,6 +1,312 @@
 #pragma once
+#include "Memory.h"
+#include "Scheduler.h"
+#include "TileCache.h"
+#include "PpuRenderers.h"
+#include <cstdint>
+#include <vector>
+using namespace std;
 
-class PPU
+//LCD modes as they read in the low 2 bits of STAT
+enum PpuMode { MODE_HBLANK, MODE_VBLANK, MODE_OAM_SCAN, MODE_TRANSFER };
+//a frame asked for with requestFrame: waiting for the next frame to start, being drawn, complete
+enum FrameRequest { REQUEST_NONE, REQUEST_WAITING, REQUEST_DRAWING, REQUEST_READY };
+
+//LCDC, STAT, LY, LYC, the scroll, window and palette registers and OAM DMA (FF40-FF4B). The PPU is only
+//visited at mode changes, three events per visible line and one per VBlank line, so LY and STAT only ever
+//change in those events. Pixels come from the Renderer policy (PpuRenderers.h): ScanlineRenderer draws
+//each line whole when its transfer ends, PixelFifoRenderer runs the pixel pipeline dot by dot for games
+//that change registers in the middle of a line. A headless PPU keeps all of the timing (LY, STAT, mode
+//lengths, interrupts) but only draws the frames asked for with requestFrame.
+template<class Renderer>
+class BasicPPU
 {
+	//Attributes
+public:
+	//LCD timing in CPU clock cycles
+	static const int CYCLES_PER_LINE = 456;
+	static const int LINES_PER_FRAME = 154;
+	static const int CYCLES_PER_FRAME = CYCLES_PER_LINE * LINES_PER_FRAME;
+	//first line of the vertical blanking period
+	static const int VBLANK_LINE = PpuRenderer::SCREEN_HEIGHT;
+	static const int OAM_SCAN_CYCLES = 80;
+	static const int SCREEN_WIDTH = PpuRenderer::SCREEN_WIDTH;
+	static const int SCREEN_HEIGHT = PpuRenderer::SCREEN_HEIGHT;
+private:
+	Memory* memory;
+	Scheduler* scheduler;
+	//registers and counters, kept in the machine state arena
+	PpuState* state;
+	//FE00-FE9F
+	uint8_t* oam;
+	TileCache tiles;
+	vector<uint32_t> frameBuffer;
+	Renderer renderer;
+	bool headless = false;
+	FrameRequest request = REQUEST_NONE;
+	//Methods
+public:
+	BasicPPU(Memory* memPtr, Scheduler* schedulerPtr);
+	const uint32_t* getFrameBuffer();
+	uint64_t getFrameCount();
+	void setHeadless(bool headless);
+	void requestFrame();
+	bool isFrameReady();
+private:
+	static uint8_t readRegister(void* component, uint16_t address);
+	static void writeRegister(void* component, uint16_t address, uint8_t value);
+	static void modeEnd(void* component, uint64_t cycle);
+	static void tileDataWritten(void* component, uint16_t start, uint16_t end);
+	bool isEnabled();
+	bool isDrawing();
+	void startFrame();
+	PpuMode getMode();
+	void setMode(PpuMode mode);
+	void setLine(uint8_t line);
+	void updateStatLine();
+};
+
+//the default, what nearly every game needs
+typedef BasicPPU<ScanlineRenderer> PPU;
+typedef BasicPPU<PixelFifoRenderer> AccuratePPU;
 
-};
\ No newline at end of file
+template<class Renderer>
+BasicPPU<Renderer>::BasicPPU(Memory* memPtr, Scheduler* schedulerPtr)
+	: tiles(memPtr->getMainMemory()), frameBuffer(SCREEN_WIDTH * SCREEN_HEIGHT, PpuRenderer::shades[0]),
+	renderer(&memPtr->getState()->ppu, memPtr->getMainMemory(), memPtr->getMainMemory() + (0xFE00 - 0x8000), &this->tiles, this->frameBuffer.data())
+{
+	this->memory = memPtr;
+	this->scheduler = schedulerPtr;
+	this->state = &memPtr->getState()->ppu;
+	this->oam = memPtr->getMainMemory() + (0xFE00 - 0x8000);
+	for (uint16_t address = 0xFF40; address <= 0xFF4B; address++)
+	{
+		memPtr->mapIo(address, this, &BasicPPU::readRegister, &BasicPPU::writeRegister);
+	}
+	schedulerPtr->setHandler(EVENT_PPU, this, &BasicPPU::modeEnd);
+	memPtr->watchWrites(0x8000, 0x97FF, this, &BasicPPU::tileDataWritten);
+}
+//SCREEN_WIDTH x SCREEN_HEIGHT RGBA pixels, the lines drawn so far of the frame in progress
+template<class Renderer>
+const uint32_t* BasicPPU<Renderer>::getFrameBuffer()
+{
+	return this->frameBuffer.data();
+}
+//frames completed, goes up as each VBlank starts
+template<class Renderer>
+uint64_t BasicPPU<Renderer>::getFrameCount()
+{
+	return this->state->frameCount;
+}
+//headless the lines are not drawn unless a frame was requested, the timing is the same either way
+template<class Renderer>
+void BasicPPU<Renderer>::setHeadless(bool headless)
+{
+	this->headless = headless;
+}
+//draws the next frame to start, headless or not. Replaces a request not yet ready
+template<class Renderer>
+void BasicPPU<Renderer>::requestFrame()
+{
+	this->request = REQUEST_WAITING;
+}
+//the requested frame is complete in the frame buffer, until the next request
+template<class Renderer>
+bool BasicPPU<Renderer>::isFrameReady()
+{
+	return this->request == REQUEST_READY;
+}
+template<class Renderer>
+uint8_t BasicPPU<Renderer>::readRegister(void* component, uint16_t address)
+{
+	BasicPPU* ppu = static_cast<BasicPPU*>(component);
+	PpuState* state = ppu->state;
+	switch (address)
+	{
+	case 0xFF40: return state->lcdc;
+	case 0xFF41: return state->stat | 0x80;
+	case 0xFF42: return state->scy;
+	case 0xFF43: return state->scx;
+	case 0xFF44: return state->ly;
+	case 0xFF45: return state->lyc;
+	case 0xFF46: return state->dma;
+	case 0xFF47: return state->bgp;
+	case 0xFF48: return state->obp0;
+	case 0xFF49: return state->obp1;
+	case 0xFF4A: return state->wy;
+	default: return state->wx;
+	}
+}
+template<class Renderer>
+void BasicPPU<Renderer>::writeRegister(void* component, uint16_t address, uint8_t value)
+{
+	BasicPPU* ppu = static_cast<BasicPPU*>(component);
+	PpuState* state = ppu->state;
+	//the pixels up to now are drawn with the registers as they were
+	if constexpr (Renderer::CATCHES_UP)
+	{
+		if (ppu->getMode() == MODE_TRANSFER && ppu->isDrawing())
+			ppu->renderer.catchUp(ppu->scheduler->getCurrentCycle());
+	}
+	switch (address)
+	{
+	case 0xFF40:
+	{
+		bool wasEnabled = ppu->isEnabled();
+		state->lcdc = value;
+		if (wasEnabled && !ppu->isEnabled())
+		{
+			//switched off the LCD sits on line 0 in HBlank and nothing is scheduled
+			ppu->scheduler->cancel(EVENT_PPU);
+			ppu->setMode(MODE_HBLANK);
+			ppu->setLine(0);
+		}
+		else if (!wasEnabled && ppu->isEnabled())
+		{
+			ppu->startFrame();
+			ppu->setMode(MODE_OAM_SCAN);
+			ppu->setLine(0);
+			ppu->scheduler->schedule(EVENT_PPU, ppu->scheduler->getCurrentCycle() + OAM_SCAN_CYCLES);
+		}
+		break;
+	}
+	case 0xFF41:
+		//the mode and LY=LYC bits are read only
+		state->stat = (state->stat & 0x07) | (value & 0x78);
+		ppu->updateStatLine();
+		break;
+	case 0xFF42: state->scy = value; break;
+	case 0xFF43: state->scx = value; break;
+	//LY is read only
+	case 0xFF44: break;
+	case 0xFF45:
+		state->lyc = value;
+		ppu->setLine(state->ly);
+		break;
+	case 0xFF46:
+		//OAM DMA is done in one go, the CPU is not kept out of the bus for its 640 cycles
+		state->dma = value;
+		for (int i = 0; i < 0xA0; i++)
+		{
+			ppu->oam[i] = ppu->memory->read((uint16_t)((value << 8) | i));
+		}
+		break;
+	case 0xFF47: state->bgp = value; break;
+	case 0xFF48: state->obp0 = value; break;
+	case 0xFF49: state->obp1 = value; break;
+	case 0xFF4A: state->wy = value; break;
+	default: state->wx = value; break;
+	}
+}
+//moves on to the next mode and schedules the end of it
+template<class Renderer>
+void BasicPPU<Renderer>::modeEnd(void* component, uint64_t cycle)
+{
+	BasicPPU* ppu = static_cast<BasicPPU*>(component);
+	PpuState* state = ppu->state;
+	switch (ppu->getMode())
+	{
+	case MODE_OAM_SCAN:
+		state->transferStart = cycle;
+		ppu->setMode(MODE_TRANSFER);
+		ppu->scheduler->schedule(EVENT_PPU, cycle + ppu->renderer.startTransfer());
+		break;
+	case MODE_TRANSFER:
+		if (ppu->isDrawing())
+			ppu->renderer.endTransfer(cycle);
+		ppu->setMode(MODE_HBLANK);
+		//HBlank takes up whatever the transfer left of the line
+		ppu->scheduler->schedule(EVENT_PPU, state->transferStart + CYCLES_PER_LINE - OAM_SCAN_CYCLES);
+		break;
+	case MODE_HBLANK:
+		if (state->ly + 1 == VBLANK_LINE)
+		{
+			ppu->setMode(MODE_VBLANK);
+			state->frameCount++;
+			if (ppu->request == REQUEST_DRAWING)
+				ppu->request = REQUEST_READY;
+			ppu->memory->requestInterrupt(INTERRUPT_VBLANK);
+			ppu->scheduler->schedule(EVENT_PPU, cycle + CYCLES_PER_LINE);
+		}
+		else
+		{
+			ppu->setMode(MODE_OAM_SCAN);
+			ppu->scheduler->schedule(EVENT_PPU, cycle + OAM_SCAN_CYCLES);
+		}
+		ppu->setLine(state->ly + 1);
+		break;
+	default:
+		if (state->ly + 1 == LINES_PER_FRAME)
+		{
+			ppu->startFrame();
+			ppu->setMode(MODE_OAM_SCAN);
+			ppu->setLine(0);
+			ppu->scheduler->schedule(EVENT_PPU, cycle + OAM_SCAN_CYCLES);
+		}
+		else
+		{
+			ppu->setLine(state->ly + 1);
+			ppu->scheduler->schedule(EVENT_PPU, cycle + CYCLES_PER_LINE);
+		}
+		break;
+	}
+}
+template<class Renderer>
+void BasicPPU<Renderer>::tileDataWritten(void* component, uint16_t start, uint16_t end)
+{
+	static_cast<BasicPPU*>(component)->tiles.invalidate(start, end);
+}
+template<class Renderer>
+bool BasicPPU<Renderer>::isEnabled()
+{
+	return (this->state->lcdc & 0x80) != 0;
+}
+template<class Renderer>
+bool BasicPPU<Renderer>::isDrawing()
+{
+	return !this->headless || this->request == REQUEST_DRAWING;
+}
+//line 0 is next, whether it is drawn is settled for the whole frame here
+template<class Renderer>
+void BasicPPU<Renderer>::startFrame()
+{
+	this->state->windowLine = 0;
+	if (this->request == REQUEST_WAITING)
+		this->request = REQUEST_DRAWING;
+}
+template<class Renderer>
+PpuMode BasicPPU<Renderer>::getMode()
+{
+	return (PpuMode)(this->state->stat & 0x03);
+}
+template<class Renderer>
+void BasicPPU<Renderer>::setMode(PpuMode mode)
+{
+	this->state->stat = (this->state->stat & ~0x03) | mode;
+	this->updateStatLine();
+}
+//sets LY and the LY=LYC flag
+template<class Renderer>
+void BasicPPU<Renderer>::setLine(uint8_t line)
+{
+	this->state->ly = line;
+	if (line == this->state->lyc)
+		this->state->stat |= 0x04;
+	else
+		this->state->stat &= ~0x04;
+	this->updateStatLine();
+}
+//the enabled STAT sources share one interrupt line, only its rising edge requests the interrupt
+template<class Renderer>
+void BasicPPU<Renderer>::updateStatLine()
+{
+	uint8_t stat = this->state->stat;
+	PpuMode mode = (PpuMode)(stat & 0x03);
+	bool line = ((stat & 0x40) && (stat & 0x04))
+		|| ((stat & 0x08) && mode == MODE_HBLANK && this->isEnabled())
+		|| ((stat & 0x10) && mode == MODE_VBLANK)
+		|| ((stat & 0x20) && mode == MODE_OAM_SCAN);
+	if (line && !this->state->statLine)
+		this->memory->requestInterrupt(INTERRUPT_LCD_STAT);
+	this->state->statLine = line;
+}
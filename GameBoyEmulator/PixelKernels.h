@@ -0,0 +1,111 @@
+#pragma once
+#include <cstdint>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define PIXEL_KERNELS_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PIXEL_KERNELS_SSE2
+#endif
+using namespace std;
+
+//Pixel conversion inner loops. The vector versions are picked at compile time from the target: AVX2
+//when the compiler targets it (-mavx2, /arch:AVX2), SSE2 on any other x86-64 build, plain C++ elsewhere.
+class PixelKernels
+{
+public:
+	static void decodeTile(const uint8_t* data, uint8_t* indices);
+	static void applyPalette(const uint8_t* indices, const uint32_t* colours, uint32_t* pixels, int count);
+};
+
+//16 bytes of 2bpp tile data (low plane then high plane for each row) to 64 colour indices, rows top to
+//bottom and the leftmost pixel (bit 7) first
+void PixelKernels::decodeTile(const uint8_t* data, uint8_t* indices)
+{
+#if defined(PIXEL_KERNELS_AVX2)
+	//every plane byte is copied to the 8 pixels of its row, then each pixel keeps only its own bit
+	const __m256i bits = _mm256_set1_epi64x(0x0102040810204080LL);
+	__m256i tile = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+	for (int half = 0; half < 2; half++)
+	{
+		//rows 0-3 then 4-7, the low plane bytes sit at even offsets and the high ones at odd
+		char row = (char)(half * 8);
+		__m256i lowBytes = _mm256_setr_epi8(row, row, row, row, row, row, row, row,
+			row + 2, row + 2, row + 2, row + 2, row + 2, row + 2, row + 2, row + 2,
+			row + 4, row + 4, row + 4, row + 4, row + 4, row + 4, row + 4, row + 4,
+			row + 6, row + 6, row + 6, row + 6, row + 6, row + 6, row + 6, row + 6);
+		__m256i highBytes = _mm256_add_epi8(lowBytes, _mm256_set1_epi8(1));
+		__m256i low = _mm256_cmpeq_epi8(_mm256_and_si256(_mm256_shuffle_epi8(tile, lowBytes), bits), bits);
+		__m256i high = _mm256_cmpeq_epi8(_mm256_and_si256(_mm256_shuffle_epi8(tile, highBytes), bits), bits);
+		__m256i result = _mm256_or_si256(_mm256_and_si256(low, _mm256_set1_epi8(1)), _mm256_and_si256(high, _mm256_set1_epi8(2)));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(indices + half * 32), result);
+	}
+#elif defined(PIXEL_KERNELS_SSE2)
+	//split the planes, then widen each byte to the 8 pixels of its row by unpacking it with itself
+	const __m128i bits = _mm_set1_epi64x(0x0102040810204080LL);
+	__m128i tile = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+	__m128i lowPlane = _mm_packus_epi16(_mm_and_si128(tile, _mm_set1_epi16(0x00FF)), _mm_setzero_si128());
+	__m128i highPlane = _mm_packus_epi16(_mm_srli_epi16(tile, 8), _mm_setzero_si128());
+	__m128i low2 = _mm_unpacklo_epi8(lowPlane, lowPlane), high2 = _mm_unpacklo_epi8(highPlane, highPlane);
+	__m128i low4[2] = { _mm_unpacklo_epi16(low2, low2), _mm_unpackhi_epi16(low2, low2) };
+	__m128i high4[2] = { _mm_unpacklo_epi16(high2, high2), _mm_unpackhi_epi16(high2, high2) };
+	for (int i = 0; i < 4; i++)
+	{
+		//two rows per vector
+		__m128i low = (i & 1) ? _mm_unpackhi_epi32(low4[i >> 1], low4[i >> 1]) : _mm_unpacklo_epi32(low4[i >> 1], low4[i >> 1]);
+		__m128i high = (i & 1) ? _mm_unpackhi_epi32(high4[i >> 1], high4[i >> 1]) : _mm_unpacklo_epi32(high4[i >> 1], high4[i >> 1]);
+		low = _mm_cmpeq_epi8(_mm_and_si128(low, bits), bits);
+		high = _mm_cmpeq_epi8(_mm_and_si128(high, bits), bits);
+		__m128i result = _mm_or_si128(_mm_and_si128(low, _mm_set1_epi8(1)), _mm_and_si128(high, _mm_set1_epi8(2)));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(indices + i * 16), result);
+	}
+#else
+	for (int row = 0; row < 8; row++)
+	{
+		uint8_t low = data[row * 2], high = data[row * 2 + 1];
+		for (int column = 0; column < 8; column++)
+		{
+			int bit = 7 - column;
+			indices[row * 8 + column] = ((low >> bit) & 1) | (((high >> bit) & 1) << 1);
+		}
+	}
+#endif
+}
+//colours holds the RGBA value of colour index 0-3 with the palette already applied, count is a multiple of 8
+void PixelKernels::applyPalette(const uint8_t* indices, const uint32_t* colours, uint32_t* pixels, int count)
+{
+#if defined(PIXEL_KERNELS_AVX2)
+	//the four colours twice over, so an index picks its colour with one lane permute
+	__m256i table = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(colours)));
+	for (int x = 0; x < count; x += 8)
+	{
+		__m256i lanes = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(indices + x)));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(pixels + x), _mm256_permutevar8x32_epi32(table, lanes));
+	}
+#elif defined(PIXEL_KERNELS_SSE2)
+	//SSE2 has no variable shuffle, each lane compares its index against all four and keeps the colour that matched
+	const __m128i zero = _mm_setzero_si128();
+	__m128i colour[4], value[4];
+	for (int i = 0; i < 4; i++)
+	{
+		colour[i] = _mm_set1_epi32((int)colours[i]);
+		value[i] = _mm_set1_epi32(i);
+	}
+	for (int x = 0; x < count; x += 8)
+	{
+		__m128i bytes = _mm_and_si128(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(indices + x)), _mm_set1_epi8(0x03));
+		__m128i words = _mm_unpacklo_epi8(bytes, zero);
+		__m128i lanes[2] = { _mm_unpacklo_epi16(words, zero), _mm_unpackhi_epi16(words, zero) };
+		for (int half = 0; half < 2; half++)
+		{
+			__m128i result = _mm_and_si128(_mm_cmpeq_epi32(lanes[half], value[0]), colour[0]);
+			for (int i = 1; i < 4; i++)
+				result = _mm_or_si128(result, _mm_and_si128(_mm_cmpeq_epi32(lanes[half], value[i]), colour[i]));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(pixels + x + half * 4), result);
+		}
+	}
+#else
+	for (int x = 0; x < count; x++)
+		pixels[x] = colours[indices[x] & 0x03];
+#endif
+}
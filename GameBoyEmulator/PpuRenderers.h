@@ -0,0 +1,436 @@
+#pragma once
+#include "MachineState.h"
+#include "TileCache.h"
+#include "PixelKernels.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+using namespace std;
+
+//What the render policies of BasicPPU share: the registers, VRAM, OAM and the frame buffer, sprite
+//selection and tile lookups. A policy provides
+//	startTransfer() - a line's transfer begins at state->transferStart, returns how many cycles it lasts
+//	catchUp(cycle) - a PPU register is about to be written during the transfer
+//	endTransfer(cycle) - the transfer is over, the line has to be in the frame buffer
+//and CATCHES_UP, false when catchUp does nothing so the PPU never calls it.
+class PpuRenderer
+{
+	//Attributes
+public:
+	static const int SCREEN_WIDTH = 160;
+	static const int SCREEN_HEIGHT = 144;
+	//mode 3 without any scroll, window or sprite delays
+	static const int TRANSFER_CYCLES = 172;
+	//at most this many sprites are drawn on a line
+	static const int MAX_LINE_SPRITES = 10;
+	//RGBA of the four shades, white to black
+	static const uint32_t shades[4];
+protected:
+	PpuState* state;
+	//8000-9FFF and FE00-FE9F
+	const uint8_t* vram;
+	const uint8_t* oam;
+	TileCache* tiles;
+	uint32_t* frameBuffer;
+	//Methods
+protected:
+	PpuRenderer(PpuState* statePtr, const uint8_t* vramPtr, const uint8_t* oamPtr, TileCache* tilesPtr, uint32_t* frameBufferPtr);
+	int selectSprites(int* sprites);
+	const uint8_t* getMapRow(uint16_t map, uint8_t mapX, uint8_t mapY);
+	const uint8_t* getSpriteRow(const uint8_t* entry);
+	static uint32_t applyPalette(uint8_t palette, uint8_t index);
+};
+
+const uint32_t PpuRenderer::shades[4] = { 0xFFFFFFFF, 0xFFAAAAAA, 0xFF555555, 0xFF000000 };
+
+PpuRenderer::PpuRenderer(PpuState* statePtr, const uint8_t* vramPtr, const uint8_t* oamPtr, TileCache* tilesPtr, uint32_t* frameBufferPtr)
+{
+	this->state = statePtr;
+	this->vram = vramPtr;
+	this->oam = oamPtr;
+	this->tiles = tilesPtr;
+	this->frameBuffer = frameBufferPtr;
+}
+//the first 10 sprites in OAM order that cover line LY, sorted so the one further left comes first and
+//a tie goes to the one earlier in OAM. Returns how many there are
+int PpuRenderer::selectSprites(int* sprites)
+{
+	int height = (this->state->lcdc & 0x04) ? 16 : 8;
+	int count = 0;
+	for (int i = 0; i < 40 && count < MAX_LINE_SPRITES; i++)
+	{
+		int top = this->oam[i * 4] - 16;
+		if (this->state->ly >= top && this->state->ly < top + height)
+			sprites[count++] = i;
+	}
+	//insertion sort on X, stable so OAM order breaks ties
+	for (int i = 1; i < count; i++)
+	{
+		int sprite = sprites[i];
+		int j = i;
+		for (; j > 0 && this->oam[sprites[j - 1] * 4 + 1] > this->oam[sprite * 4 + 1]; j--)
+			sprites[j] = sprites[j - 1];
+		sprites[j] = sprite;
+	}
+	return count;
+}
+//decoded row of the map tile under mapX/mapY, the pixel under mapX is at mapX & 7
+const uint8_t* PpuRenderer::getMapRow(uint16_t map, uint8_t mapX, uint8_t mapY)
+{
+	uint8_t tile = this->vram[map - 0x8000 + (mapY >> 3) * 32 + (mapX >> 3)];
+	//LCDC bit 4 picks between unsigned numbers from 8000 and signed ones from 9000
+	int index = (this->state->lcdc & 0x10) ? tile : 256 + (int8_t)tile;
+	return this->tiles->getRow(index, mapY & 7);
+}
+//decoded row of the OAM entry's tile on line LY, not yet flipped horizontally
+const uint8_t* PpuRenderer::getSpriteRow(const uint8_t* entry)
+{
+	int height = (this->state->lcdc & 0x04) ? 16 : 8;
+	//LCDC bit 2 can change after the sprite was picked, the row wraps inside the new height
+	int row = (this->state->ly - (entry[0] - 16)) & (height - 1);
+	if (entry[3] & 0x40)
+		row = height - 1 - row;
+	//the second tile of an 8x16 sprite follows the first
+	int tile = (height == 16 ? entry[2] & 0xFE : entry[2]) + (row >> 3);
+	return this->tiles->getRow(tile, row & 7);
+}
+uint32_t PpuRenderer::applyPalette(uint8_t palette, uint8_t index)
+{
+	return shades[(palette >> (index * 2)) & 0x03];
+}
+
+//Render policy that draws each line whole when its transfer ends, with the registers as they are then.
+//Transfers always last TRANSFER_CYCLES.
+class ScanlineRenderer : public PpuRenderer
+{
+	//Attributes
+public:
+	static const bool CATCHES_UP = false;
+	//Methods
+public:
+	ScanlineRenderer(PpuState* statePtr, const uint8_t* vramPtr, const uint8_t* oamPtr, TileCache* tilesPtr, uint32_t* frameBufferPtr);
+	int startTransfer();
+	void catchUp(uint64_t) {}
+	void endTransfer(uint64_t cycle);
+private:
+	void renderBackground(uint8_t* indices, uint32_t* pixels);
+	int copyTileRows(uint8_t* indices, int x, int end, uint16_t map, uint8_t mapX, uint8_t mapY);
+	void renderSprites(const uint8_t* indices, uint32_t* pixels);
+};
+
+ScanlineRenderer::ScanlineRenderer(PpuState* statePtr, const uint8_t* vramPtr, const uint8_t* oamPtr, TileCache* tilesPtr, uint32_t* frameBufferPtr)
+	: PpuRenderer(statePtr, vramPtr, oamPtr, tilesPtr, frameBufferPtr)
+{
+}
+int ScanlineRenderer::startTransfer()
+{
+	return TRANSFER_CYCLES;
+}
+//draws line LY
+void ScanlineRenderer::endTransfer(uint64_t)
+{
+	uint32_t* pixels = &this->frameBuffer[this->state->ly * SCREEN_WIDTH];
+	//background/window colour index of each pixel before the palette, sprites need it for their priority
+	uint8_t indices[SCREEN_WIDTH];
+	this->renderBackground(indices, pixels);
+	if (this->state->lcdc & 0x02)
+		this->renderSprites(indices, pixels);
+}
+void ScanlineRenderer::renderBackground(uint8_t* indices, uint32_t* pixels)
+{
+	PpuState* state = this->state;
+	//the window starts at WX-7, off the line entirely when that is past the right edge
+	int windowStart = (state->lcdc & 0x20) && state->ly >= state->wy && state->wx < SCREEN_WIDTH + 7 ? state->wx - 7 : SCREEN_WIDTH;
+	//the window keeps counting its lines while blanked, as it does in the pixel FIFO
+	uint8_t windowLine = state->windowLine;
+	if (windowStart < SCREEN_WIDTH)
+		state->windowLine++;
+	//on the DMG LCDC bit 0 blanks background and window alike
+	if (!(state->lcdc & 0x01))
+	{
+		memset(indices, 0, SCREEN_WIDTH);
+		for (int x = 0; x < SCREEN_WIDTH; x++)
+		{
+			pixels[x] = shades[0];
+		}
+		return;
+	}
+	uint16_t backgroundMap = (state->lcdc & 0x08) ? 0x9C00 : 0x9800;
+	uint16_t windowMap = (state->lcdc & 0x40) ? 0x9C00 : 0x9800;
+	int x = 0;
+	while (x < windowStart)
+		x = this->copyTileRows(indices, x, windowStart, backgroundMap, (uint8_t)(state->scx + x), (uint8_t)(state->scy + state->ly));
+	while (x < SCREEN_WIDTH)
+		x = this->copyTileRows(indices, x, SCREEN_WIDTH, windowMap, (uint8_t)(x - windowStart), windowLine);
+	uint32_t colours[4];
+	for (int i = 0; i < 4; i++)
+	{
+		colours[i] = applyPalette(state->bgp, i);
+	}
+	PixelKernels::applyPalette(indices, colours, pixels, SCREEN_WIDTH);
+}
+//copies the decoded row of the map tile under mapX/mapY into indices from x, as far as the tile or end
+//goes, and returns where it stopped
+int ScanlineRenderer::copyTileRows(uint8_t* indices, int x, int end, uint16_t map, uint8_t mapX, uint8_t mapY)
+{
+	int column = mapX & 7;
+	int count = min(8 - column, end - x);
+	memcpy(indices + x, this->getMapRow(map, mapX, mapY) + column, count);
+	return x + count;
+}
+void ScanlineRenderer::renderSprites(const uint8_t* indices, uint32_t* pixels)
+{
+	PpuState* state = this->state;
+	int sprites[MAX_LINE_SPRITES];
+	int count = this->selectSprites(sprites);
+	//a pixel taken by a higher priority sprite stays taken even where the background hides that sprite
+	bool taken[SCREEN_WIDTH] = {};
+	for (int i = 0; i < count; i++)
+	{
+		const uint8_t* entry = &this->oam[sprites[i] * 4];
+		uint8_t attributes = entry[3];
+		const uint8_t* tileRow = this->getSpriteRow(entry);
+		uint8_t palette = (attributes & 0x10) ? state->obp1 : state->obp0;
+		for (int column = 0; column < 8; column++)
+		{
+			int x = entry[1] - 8 + column;
+			if (x < 0 || x >= SCREEN_WIDTH || taken[x])
+				continue;
+			uint8_t index = tileRow[(attributes & 0x20) ? 7 - column : column];
+			//colour 0 is transparent
+			if (index == 0)
+				continue;
+			taken[x] = true;
+			if ((attributes & 0x80) && indices[x] != 0)
+				continue;
+			pixels[x] = applyPalette(palette, index);
+		}
+	}
+}
+
+//Render policy that runs the DMG pixel pipeline a dot at a time: a background fetcher (tile number, low
+//plane, high plane, 2 dots each) feeding an 8 pixel FIFO, a sprite FIFO merged into it, and the palettes
+//applied as each pixel leaves. Before every PPU register write during a transfer the pipeline is run up to
+//that cycle, so mid-line changes to scroll, window, LCDC and palettes land on the right pixel. The PPU is
+//told how long the transfer takes when it starts, from the SCX, window and sprite delays.
+class PixelFifoRenderer : public PpuRenderer
+{
+	//Attributes
+public:
+	static const bool CATCHES_UP = true;
+private:
+	//the fetcher's first tile of a line is fetched again before any pixel comes out
+	static const int STARTUP_DOTS = 6;
+	static const int FETCH_DOTS = 6;
+	static const int SPRITE_FETCH_DOTS = 6;
+	static const uint8_t blankRow[8];
+	struct SpritePixel
+	{
+		uint8_t index;
+		//OBP1 instead of OBP0
+		bool palette1;
+		//behind background colours 1-3
+		bool behind;
+	};
+	//transferStart of the line in the pipeline and how many of its dots have run
+	uint64_t lineStart = UINT64_MAX;
+	uint64_t dots = 0;
+	//pixels put on the line so far, and how many more the FIFO throws away first (SCX & 7, WX < 7)
+	int lcdX = 0;
+	int discard = 0;
+	uint8_t background[8];
+	int backgroundHead = 0;
+	int backgroundCount = 0;
+	//fetcher step (0-2, 3 waiting to push), dots into the step and tiles fetched since the line or window started
+	int fetchStep = 0;
+	int fetchDots = 0;
+	int fetchX = 0;
+	const uint8_t* fetchedRow = blankRow;
+	bool windowActive = false;
+	//the line's sprites and the next one to fetch
+	int sprites[MAX_LINE_SPRITES];
+	int spriteCount = 0;
+	int nextSprite = 0;
+	//dots the pixel output is held for, at the end of a sprite fetch pendingSprite goes into the sprite FIFO
+	int stall = 0;
+	int pendingSprite = -1;
+	//slot 0 is mixed with the next background pixel
+	SpritePixel spritePixels[8];
+	//Methods
+public:
+	PixelFifoRenderer(PpuState* statePtr, const uint8_t* vramPtr, const uint8_t* oamPtr, TileCache* tilesPtr, uint32_t* frameBufferPtr);
+	int startTransfer();
+	void catchUp(uint64_t cycle);
+	void endTransfer(uint64_t cycle);
+private:
+	void beginLine();
+	void step();
+	const uint8_t* fetchRow();
+	void mergeSprite(int sprite);
+	void outputPixel();
+};
+
+const uint8_t PixelFifoRenderer::blankRow[8] = {};
+
+PixelFifoRenderer::PixelFifoRenderer(PpuState* statePtr, const uint8_t* vramPtr, const uint8_t* oamPtr, TileCache* tilesPtr, uint32_t* frameBufferPtr)
+	: PpuRenderer(statePtr, vramPtr, oamPtr, tilesPtr, frameBufferPtr)
+{
+}
+int PixelFifoRenderer::startTransfer()
+{
+	this->beginLine();
+	PpuState* state = this->state;
+	int cycles = TRANSFER_CYCLES + (state->scx & 7);
+	if ((state->lcdc & 0x20) && state->ly >= state->wy && state->wx < SCREEN_WIDTH + 7)
+		cycles += FETCH_DOTS;
+	if (state->lcdc & 0x02)
+	{
+		for (int i = 0; i < this->spriteCount; i++)
+		{
+			if (this->oam[this->sprites[i] * 4 + 1] < SCREEN_WIDTH + 8)
+				cycles += SPRITE_FETCH_DOTS;
+		}
+	}
+	return cycles;
+}
+void PixelFifoRenderer::catchUp(uint64_t cycle)
+{
+	//a restored snapshot can land in the middle of a line the pipeline never saw, it starts that line over
+	if (this->lineStart != this->state->transferStart)
+		this->beginLine();
+	while (this->lcdX < SCREEN_WIDTH && this->lineStart + this->dots < cycle)
+		this->step();
+}
+void PixelFifoRenderer::endTransfer(uint64_t)
+{
+	if (this->lineStart != this->state->transferStart)
+		this->beginLine();
+	//the pipeline runs on past the scheduled end when mid-line writes made the line longer than predicted
+	while (this->lcdX < SCREEN_WIDTH)
+		this->step();
+	if (this->windowActive)
+		this->state->windowLine++;
+	this->windowActive = false;
+}
+void PixelFifoRenderer::beginLine()
+{
+	this->lineStart = this->state->transferStart;
+	this->dots = 0;
+	this->lcdX = 0;
+	this->discard = this->state->scx & 7;
+	this->backgroundCount = 0;
+	this->fetchStep = 0;
+	this->fetchDots = 0;
+	this->fetchX = 0;
+	this->windowActive = false;
+	this->spriteCount = this->selectSprites(this->sprites);
+	this->nextSprite = 0;
+	this->stall = STARTUP_DOTS;
+	this->pendingSprite = -1;
+	memset(this->spritePixels, 0, sizeof(this->spritePixels));
+}
+//one dot: the window starting and the fetcher moving on, then either a sprite fetch or at most one pixel out
+void PixelFifoRenderer::step()
+{
+	PpuState* state = this->state;
+	this->dots++;
+	if (this->stall > 0)
+	{
+		if (--this->stall == 0 && this->pendingSprite >= 0)
+		{
+			this->mergeSprite(this->pendingSprite);
+			this->pendingSprite = -1;
+		}
+		return;
+	}
+	if (!this->windowActive && (state->lcdc & 0x20) && state->ly >= state->wy && state->wx < SCREEN_WIDTH + 7 && this->lcdX >= state->wx - 7)
+	{
+		//the background pixels are dropped and the fetcher starts over on the window map
+		this->windowActive = true;
+		this->backgroundCount = 0;
+		this->fetchStep = 0;
+		this->fetchDots = 0;
+		this->fetchX = 0;
+		this->discard = state->wx < 7 ? 7 - state->wx : 0;
+	}
+	//the fetcher only pushes into an empty FIFO, a dot after its last step at the earliest
+	if (this->fetchStep == 3 && this->backgroundCount == 0)
+	{
+		memcpy(this->background, this->fetchedRow, 8);
+		this->backgroundHead = 0;
+		this->backgroundCount = 8;
+		this->fetchStep = 0;
+		this->fetchX++;
+	}
+	if (this->fetchStep < 3 && ++this->fetchDots == FETCH_DOTS / 3)
+	{
+		this->fetchDots = 0;
+		if (this->fetchStep == 0)
+			this->fetchedRow = this->fetchRow();
+		this->fetchStep++;
+	}
+	//a sprite is fetched once the background FIFO has pixels and the output reaches its left edge
+	while (this->backgroundCount > 0 && this->nextSprite < this->spriteCount && this->oam[this->sprites[this->nextSprite] * 4 + 1] - 8 <= this->lcdX)
+	{
+		int sprite = this->sprites[this->nextSprite++];
+		if (state->lcdc & 0x02)
+		{
+			this->pendingSprite = sprite;
+			this->stall = SPRITE_FETCH_DOTS - 1;
+			return;
+		}
+	}
+	if (this->backgroundCount > 0)
+		this->outputPixel();
+}
+//tile row for the fetcher's position, scroll and maps as the registers are now
+const uint8_t* PixelFifoRenderer::fetchRow()
+{
+	PpuState* state = this->state;
+	//on the DMG LCDC bit 0 blanks background and window alike
+	if (!(state->lcdc & 0x01))
+		return blankRow;
+	if (this->windowActive)
+		return this->getMapRow((state->lcdc & 0x40) ? 0x9C00 : 0x9800, (uint8_t)(this->fetchX * 8), state->windowLine);
+	return this->getMapRow((state->lcdc & 0x08) ? 0x9C00 : 0x9800, (uint8_t)((state->scx & ~7) + this->fetchX * 8), (uint8_t)(state->scy + state->ly));
+}
+//the sprite's opaque pixels fill the sprite FIFO slots no earlier sprite has taken
+void PixelFifoRenderer::mergeSprite(int sprite)
+{
+	const uint8_t* entry = &this->oam[sprite * 4];
+	uint8_t attributes = entry[3];
+	const uint8_t* tileRow = this->getSpriteRow(entry);
+	for (int column = 0; column < 8; column++)
+	{
+		//columns left of the output (sprites hanging off the left edge) are already gone
+		int slot = entry[1] - 8 + column - this->lcdX;
+		if (slot < 0 || slot >= 8)
+			continue;
+		uint8_t index = tileRow[(attributes & 0x20) ? 7 - column : column];
+		if (index == 0 || this->spritePixels[slot].index != 0)
+			continue;
+		this->spritePixels[slot].index = index;
+		this->spritePixels[slot].palette1 = (attributes & 0x10) != 0;
+		this->spritePixels[slot].behind = (attributes & 0x80) != 0;
+	}
+}
+void PixelFifoRenderer::outputPixel()
+{
+	PpuState* state = this->state;
+	uint8_t index = this->background[this->backgroundHead++];
+	this->backgroundCount--;
+	if (this->discard > 0)
+	{
+		this->discard--;
+		return;
+	}
+	SpritePixel sprite = this->spritePixels[0];
+	memmove(this->spritePixels, this->spritePixels + 1, sizeof(SpritePixel) * 7);
+	this->spritePixels[7] = SpritePixel();
+	uint32_t colour;
+	if (sprite.index != 0 && (state->lcdc & 0x02) && !(sprite.behind && index != 0))
+		colour = applyPalette(sprite.palette1 ? state->obp1 : state->obp0, sprite.index);
+	else
+		colour = applyPalette(state->bgp, index);
+	this->frameBuffer[state->ly * SCREEN_WIDTH + this->lcdX++] = colour;
+}
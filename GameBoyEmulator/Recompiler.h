@@ -0,0 +1,879 @@
+#pragma once
+#include "BlockCache.h"
+#include <cstdint>
+#include <cstring>
+using namespace std;
+
+//Define DYNAMIC_RECOMPILER to translate hot blocks into x86-64 code. Other hosts keep interpreting.
+#if defined(DYNAMIC_RECOMPILER) && (defined(__x86_64__) || defined(_M_X64))
+#define DYNAMIC_RECOMPILER_ENABLED
+#endif
+
+#ifdef DYNAMIC_RECOMPILER_ENABLED
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+//byte offsets of the guest registers inside the RegisterFile the native code is called with
+struct GuestLayout
+{
+	//indexed by the 3 bit register field of an opcode, entry 6 ((HL)) is unused
+	int registerOffset[8];
+	int flagsOffset;
+	int stackPointerOffset;
+	int programCounterOffset;
+	//64 bit clock cycle counter
+	int cycleCountOffset;
+};
+
+//runs one micro op in the interpreter, returns false if the rest of the block must not run
+typedef bool (*NativeFallback)(CPU* cpu, const MicroOp* op);
+
+class Recompiler
+{
+	//Attributes
+public:
+	//a block is only translated once it has been run this many times
+	static const int HOT_THRESHOLD = 64;
+	static const size_t ARENA_SIZE = 4 * 1024 * 1024;
+	//worst case size of one translated block (every op falling back to the interpreter)
+	static const size_t MAX_BLOCK_CODE = 8 * 1024;
+private:
+	//host registers
+	enum HostRegister { RAX, RCX, RDX, RBX, RSP, RBP, RSI, RDI, R8, R9, R10, R11, R12, R13, R14, R15 };
+	//x86 condition codes
+	enum HostCondition { COND_C = 0x2, COND_Z = 0x4, COND_NZ = 0x5 };
+	//guest registers pinned in host registers for the whole block, indexed like GuestLayout
+	static const int pinned[8];
+	static const int PINNED_F = R13;
+	static const int PINNED_SP = R9;
+	//the guest RegisterFile
+	static const int BASE = RBX;
+#ifdef _WIN32
+	static const int ARG0 = RCX, ARG1 = RDX;
+#else
+	static const int ARG0 = RDI, ARG1 = RSI;
+#endif
+	//F value for every AH after LAHF (SF ZF 0 AF 0 PF 1 CF) with Z, H and C in place
+	uint8_t lahfToFlags[256];
+	uint8_t* arena = nullptr;
+	size_t arenaUsed = 0;
+	uint8_t* code = nullptr;
+	GuestLayout layout;
+	//passed to the fallbacks, the translated code of one Recompiler only ever runs on its own CPU
+	CPU* cpu = nullptr;
+	//Methods
+public:
+	Recompiler();
+	~Recompiler();
+	Recompiler(const Recompiler&) = delete;
+	Recompiler& operator=(const Recompiler&) = delete;
+	void setLayout(const GuestLayout &guestLayout, CPU* owner);
+	bool shouldCompile(const DecodedBlock &block);
+	NativeBlock compile(const DecodedBlock &block, NativeFallback fallback);
+	void reset();
+private:
+	bool canTranslate(const MicroOp &op);
+	void getFlagUsage(const MicroOp &op, uint8_t &read, uint8_t &written);
+	void translate(const MicroOp &op, bool flagsNeeded);
+	void translateCB(const MicroOp &op, bool flagsNeeded);
+	void translateBranch(const MicroOp &op);
+	void emitFallback(const MicroOp &op, NativeFallback fallback);
+	void emitAddCycles(uint32_t cycles);
+	void emitSpill();
+	void emitReload();
+	void emitReadPair(int dst, int pair);
+	void emitWritePair(int pair, int src);
+	void emitFlagsFromLahf(uint8_t fromLahf, uint8_t keep, uint8_t set);
+	void emitFlagsZeroCarry(int reg);
+	void emitFlagsCarryOnly();
+	void emitFlagsZeroOnly(uint8_t set);
+
+	//x86-64 encoding
+	void emit8(uint8_t value);
+	void emit32(uint32_t value);
+	void emit64(uint64_t value);
+	void emitRex(bool wide, int reg, int rm, bool byteRegisters);
+	void emitModRM(int reg, int rm);
+	void emitModRMBase(int reg, int32_t displacement);
+	void aluRR8(uint8_t opCode, int dst, int src);
+	void aluRI8(int digit, int dst, uint8_t imm);
+	void aluRR32(uint8_t opCode, int dst, int src);
+	void aluRI32(int digit, int dst, uint32_t imm);
+	void movRR32(int dst, int src);
+	void movRR64(int dst, int src);
+	void movRI32(int dst, uint32_t imm);
+	void movRI64(int dst, uint64_t imm);
+	void movzxR8(int dst, int src);
+	void movzxR16(int dst, int src);
+	void loadByte(int dst, int32_t displacement);
+	void loadWord(int dst, int32_t displacement);
+	void storeByte(int32_t displacement, int src);
+	void storeWord(int32_t displacement, int src);
+	void addMemoryI32(int32_t displacement, uint32_t imm);
+	void addMemoryR64(int32_t displacement, int src);
+	void shiftRI32(int digit, int dst, uint8_t count);
+	void shiftR8(int digit, int dst, uint8_t count);
+	void btRI32(int dst, uint8_t bit);
+	void testRR8(int a, int b);
+	void testRI8(int dst, uint8_t imm);
+	void testRI32(int dst, uint32_t imm);
+	void setcc(int condition, int dst);
+	void cmovcc(int condition, int dst, int src);
+	void notR8(int dst);
+	void push(int reg);
+	void pop(int reg);
+	uint8_t* jzForward();
+	void patchForward(uint8_t* jump, uint8_t* target);
+};
+
+//B, C, D, E, H, L, (HL), A
+const int Recompiler::pinned[8] = { R14, R15, RSI, RDI, RBP, R8, -1, R12 };
+
+Recompiler::Recompiler()
+{
+#ifdef _WIN32
+	this->arena = (uint8_t*)VirtualAlloc(nullptr, ARENA_SIZE, MEM_COMMIT | MEM_RESERVE, PAGE_EXECUTE_READWRITE);
+#else
+	void* mapping = mmap(nullptr, ARENA_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	this->arena = mapping == MAP_FAILED ? nullptr : (uint8_t*)mapping;
+#endif
+	for (int ah = 0; ah < 256; ah++)
+	{
+		this->lahfToFlags[ah] = ((ah & 0x40) ? 0x80 : 0) | ((ah & 0x10) ? 0x20 : 0) | ((ah & 0x01) ? 0x10 : 0);
+	}
+	memset(&this->layout, 0, sizeof(this->layout));
+}
+Recompiler::~Recompiler()
+{
+	if (this->arena == nullptr)
+		return;
+#ifdef _WIN32
+	VirtualFree(this->arena, 0, MEM_RELEASE);
+#else
+	munmap(this->arena, ARENA_SIZE);
+#endif
+}
+void Recompiler::setLayout(const GuestLayout &guestLayout, CPU* owner)
+{
+	this->layout = guestLayout;
+	this->cpu = owner;
+}
+//throws away every translation, the caller must forget the NativeBlock pointers it holds
+void Recompiler::reset()
+{
+	this->arenaUsed = 0;
+}
+//cold code never gets here. Code outside ROM can be rewritten at any time and blocks that are
+//mostly memory/IO accesses would spend all their time in fallbacks, so both stay interpreted
+bool Recompiler::shouldCompile(const DecodedBlock &block)
+{
+	if (this->arena == nullptr || block.startAddress >= 0x8000)
+		return false;
+	size_t translatable = 0;
+	for (const MicroOp &op : block.ops)
+	{
+		if (this->canTranslate(op))
+			translatable++;
+	}
+	return translatable > 0 && translatable * 2 >= block.ops.size();
+}
+//native version of the block, or nullptr when the arena is full
+NativeBlock Recompiler::compile(const DecodedBlock &block, NativeFallback fallback)
+{
+	if (this->arena == nullptr || this->arenaUsed + MAX_BLOCK_CODE > ARENA_SIZE)
+		return nullptr;
+	uint8_t* start = this->arena + this->arenaUsed;
+	this->code = start;
+
+	//flag liveness, walking backwards from the end of the block where everything is live
+	size_t count = block.ops.size();
+	vector<bool> flagsNeeded(count);
+	uint8_t live = 0xF0;
+	for (size_t i = count; i-- > 0;)
+	{
+		uint8_t read = 0, written = 0;
+		this->getFlagUsage(block.ops[i], read, written);
+		flagsNeeded[i] = (written & live) != 0;
+		live = (live & ~written) | read;
+	}
+
+	//prologue: save every register we pin, align the stack for calls and load the guest registers
+	const int saved[8] = { RBX, RBP, RSI, RDI, R12, R13, R14, R15 };
+	for (int i = 0; i < 8; i++)
+		this->push(saved[i]);
+	//8 pushes leave RSP 8 off a 16 byte boundary, 40 more realigns it and leaves Win64 shadow space
+	this->emit8(0x48); this->emit8(0x83); this->emit8(0xEC); this->emit8(40);
+	this->movRR64(BASE, ARG0);
+	this->emitReload();
+
+	vector<uint8_t*> exits;
+	bool lastWasFallback = false;
+	//cycles of translated ops not yet added to the counter, fallbacks count their own
+	uint32_t pendingCycles = 0;
+	for (size_t i = 0; i < count; i++)
+	{
+		const MicroOp &op = block.ops[i];
+		bool last = i + 1 == count;
+		lastWasFallback = false;
+		if (!this->canTranslate(op))
+		{
+			//the counter has to be current in case the op reads a timer
+			this->emitAddCycles(pendingCycles);
+			pendingCycles = 0;
+			this->emitFallback(op, fallback);
+			if (last)
+				lastWasFallback = true;
+			else
+			{
+				//the fallback spilled the registers, stop if it invalidated the block
+				this->testRR8(RAX, RAX);
+				exits.push_back(this->jzForward());
+				this->emitReload();
+			}
+		}
+		else if (op.properties & OPCODE_ENDS_BLOCK)
+		{
+			pendingCycles += op.cycles;
+			this->translateBranch(op);
+		}
+		else
+		{
+			pendingCycles += op.cycles;
+			this->translate(op, flagsNeeded[i]);
+			if (last)
+			{
+				this->movRI32(RAX, (uint16_t)(op.address + op.length));
+				this->storeWord(this->layout.programCounterOffset, RAX);
+			}
+		}
+	}
+	this->emitAddCycles(pendingCycles);
+	//fallbacks leave the guest registers in memory, translated code leaves them pinned
+	if (!lastWasFallback)
+		this->emitSpill();
+	uint8_t* epilogue = this->code;
+	for (uint8_t* jump : exits)
+		this->patchForward(jump, epilogue);
+	this->emit8(0x48); this->emit8(0x83); this->emit8(0xC4); this->emit8(40);
+	for (int i = 7; i >= 0; i--)
+		this->pop(saved[i]);
+	this->emit8(0xC3);
+
+	this->arenaUsed += this->code - start;
+	//keep each block 16 byte aligned
+	this->arenaUsed = (this->arenaUsed + 15) & ~(size_t)15;
+	return (NativeBlock)start;
+}
+
+//Which micro ops have native translations
+bool Recompiler::canTranslate(const MicroOp &op)
+{
+	uint8_t x = op.opCode >> 6, y = (op.opCode >> 3) & 0x7, z = op.opCode & 0x7;
+	if (op.prefixed)
+		return z != 6;
+	switch (x)
+	{
+	case 0:
+		if (z == 0)
+			return op.opCode == 0x00 || op.opCode == 0x18 || y >= 4;
+		if (z == 1 || z == 3)
+			return true;
+		if (z == 4 || z == 5 || z == 6)
+			return y != 6;
+		if (z == 7)
+			return op.opCode != 0x27;
+		return false;
+	case 1:
+		return y != 6 && z != 6;
+	case 2:
+		return z != 6;
+	default:
+		return op.opCode == 0xC3 || op.opCode == 0xC2 || op.opCode == 0xCA || op.opCode == 0xD2 || op.opCode == 0xDA || z == 6;
+	}
+}
+//F bits (Z N H C) the op reads and overwrites. Fallbacks are treated as reading everything
+void Recompiler::getFlagUsage(const MicroOp &op, uint8_t &read, uint8_t &written)
+{
+	if (!this->canTranslate(op))
+	{
+		read = 0xF0;
+		written = 0;
+		return;
+	}
+	const OpcodeInfo &info = op.prefixed ? cbOpcodes[op.opCode] : baseOpcodes[op.opCode];
+	read = info.flagsRead;
+	written = info.flagsWritten;
+}
+
+//Code generation
+void Recompiler::translate(const MicroOp &op, bool flagsNeeded)
+{
+	if (op.prefixed)
+	{
+		this->translateCB(op, flagsNeeded);
+		return;
+	}
+	uint8_t x = op.opCode >> 6, y = (op.opCode >> 3) & 0x7, z = op.opCode & 0x7;
+	uint8_t pair = y >> 1;
+	uint16_t imm16 = op.operands[0] | (op.operands[1] << 8);
+	//register field and ALU operation of the 0x80-0xBF and 0xC6-0xFE groups
+	int src = -1;
+	uint8_t aluOperation = y;
+	if (x == 0)
+	{
+		switch (z)
+		{
+		case 0:
+			//NOP
+			return;
+		case 1:
+			if ((y & 1) == 0)
+			{
+				//LD rr, d16
+				if (pair == 3)
+					this->movRI32(PINNED_SP, imm16);
+				else
+				{
+					this->movRI32(pinned[pair * 2], imm16 >> 8);
+					this->movRI32(pinned[pair * 2 + 1], imm16 & 0xFF);
+				}
+				return;
+			}
+			//ADD HL, rr. H is the carry out of bit 11, which x86 has no flag for
+			this->emitReadPair(RAX, 2);
+			this->emitReadPair(RCX, pair);
+			if (flagsNeeded)
+			{
+				this->movRR32(RDX, RAX);
+				this->aluRI32(4, RDX, 0xFFF);
+				this->movRR32(R10, RCX);
+				this->aluRI32(4, R10, 0xFFF);
+				this->aluRR32(0x01, RDX, R10);
+				this->shiftRI32(5, RDX, 12);
+				this->shiftRI32(4, RDX, 5);
+			}
+			this->aluRR32(0x01, RAX, RCX);
+			if (flagsNeeded)
+			{
+				this->movRR32(R10, RAX);
+				this->shiftRI32(5, R10, 16);
+				this->shiftRI32(4, R10, 4);
+				this->aluRI32(4, PINNED_F, FLAG_ZERO);
+				this->aluRR32(0x09, PINNED_F, RDX);
+				this->aluRR32(0x09, PINNED_F, R10);
+			}
+			this->emitWritePair(2, RAX);
+			return;
+		case 3:
+			//INC rr / DEC rr
+			this->emitReadPair(RAX, pair);
+			this->aluRI32((y & 1) ? 5 : 0, RAX, 1);
+			this->emitWritePair(pair, RAX);
+			return;
+		case 4:
+		case 5:
+			//INC r / DEC r, C is left alone
+			this->aluRI8(z == 4 ? 0 : 5, pinned[y], 1);
+			if (flagsNeeded)
+				this->emitFlagsFromLahf(FLAG_ZERO | FLAG_HALF_CARRY, FLAG_CARRY, z == 4 ? 0 : FLAG_SUBTRACT);
+			return;
+		case 6:
+			//LD r, d8
+			this->movRI32(pinned[y], op.operands[0]);
+			return;
+		default:
+			switch (y)
+			{
+			case 0:
+			case 1:
+			case 2:
+			case 3:
+				//RLCA, RRCA, RLA, RRA are ROL, ROR, RCL, RCR with Z forced to 0
+				if (y >= 2)
+					this->btRI32(PINNED_F, 4);
+				this->shiftR8(y, pinned[7], 1);
+				if (flagsNeeded)
+					this->emitFlagsCarryOnly();
+				return;
+			case 5:
+				//CPL
+				this->notR8(pinned[7]);
+				this->aluRI32(1, PINNED_F, FLAG_SUBTRACT | FLAG_HALF_CARRY);
+				return;
+			case 6:
+				//SCF
+				this->aluRI32(4, PINNED_F, FLAG_ZERO);
+				this->aluRI32(1, PINNED_F, FLAG_CARRY);
+				return;
+			default:
+				//CCF
+				this->aluRI32(4, PINNED_F, FLAG_ZERO | FLAG_CARRY);
+				this->aluRI32(6, PINNED_F, FLAG_CARRY);
+				return;
+			}
+		}
+	}
+	if (x == 1)
+	{
+		//LD r, r'
+		if (y != z)
+			this->movRR32(pinned[y], pinned[z]);
+		return;
+	}
+	if (x == 2)
+		src = pinned[z];
+	//CP without anyone reading the flags does nothing
+	if (aluOperation == ALU_CP && !flagsNeeded)
+		return;
+	//ADC and SBC take the guest carry in through the host carry
+	if (aluOperation == ALU_ADC || aluOperation == ALU_SBC)
+		this->btRI32(PINNED_F, 4);
+	//opcode of the register form and /digit of the immediate form for each ALU operation
+	const uint8_t registerForm[8] = { 0x00, 0x10, 0x28, 0x18, 0x20, 0x30, 0x08, 0x38 };
+	const int immediateForm[8] = { 0, 2, 5, 3, 4, 6, 1, 7 };
+	if (src >= 0)
+		this->aluRR8(registerForm[aluOperation], pinned[7], src);
+	else
+		this->aluRI8(immediateForm[aluOperation], pinned[7], op.operands[0]);
+	if (!flagsNeeded)
+		return;
+	switch (aluOperation)
+	{
+	case ALU_ADD:
+	case ALU_ADC:
+		this->emitFlagsFromLahf(FLAG_ZERO | FLAG_HALF_CARRY | FLAG_CARRY, 0, 0);
+		break;
+	case ALU_SUB:
+	case ALU_SBC:
+	case ALU_CP:
+		this->emitFlagsFromLahf(FLAG_ZERO | FLAG_HALF_CARRY | FLAG_CARRY, 0, FLAG_SUBTRACT);
+		break;
+	case ALU_AND:
+		this->emitFlagsZeroOnly(FLAG_HALF_CARRY);
+		break;
+	default:
+		this->emitFlagsZeroOnly(0);
+		break;
+	}
+}
+void Recompiler::translateCB(const MicroOp &op, bool flagsNeeded)
+{
+	uint8_t x = op.opCode >> 6, y = (op.opCode >> 3) & 0x7, z = op.opCode & 0x7;
+	int reg = pinned[z];
+	switch (x)
+	{
+	case 0:
+		if (y == SHIFT_SWAP)
+		{
+			//SWAP is a rotate by 4 that clears C
+			this->shiftR8(0, reg, 4);
+			if (flagsNeeded)
+			{
+				this->testRR8(reg, reg);
+				this->emitFlagsZeroOnly(0);
+			}
+			return;
+		}
+		//RLC, RRC, RL, RR, SLA, SRA, SRL map onto ROL, ROR, RCL, RCR, SHL, SAR, SHR
+		{
+			const int digit[8] = { 0, 1, 2, 3, 4, 7, 0, 5 };
+			if (y == SHIFT_RL || y == SHIFT_RR)
+				this->btRI32(PINNED_F, 4);
+			this->shiftR8(digit[y], reg, 1);
+			if (flagsNeeded)
+				this->emitFlagsZeroCarry(reg);
+		}
+		return;
+	case 1:
+		//BIT b, r
+		if (!flagsNeeded)
+			return;
+		this->testRI8(reg, 1 << y);
+		this->setcc(COND_Z, RAX);
+		this->movzxR8(RAX, RAX);
+		this->shiftRI32(4, RAX, 7);
+		this->aluRI32(4, PINNED_F, FLAG_CARRY);
+		this->aluRI32(1, PINNED_F, FLAG_HALF_CARRY);
+		this->aluRR32(0x09, PINNED_F, RAX);
+		return;
+	case 2:
+		//RES b, r
+		this->aluRI32(4, reg, 0xFF & ~(1 << y));
+		return;
+	default:
+		//SET b, r
+		this->aluRI32(1, reg, 1 << y);
+		return;
+	}
+}
+//JR, JR cc, JP a16, JP cc. All targets are known, only the condition is evaluated at run time
+void Recompiler::translateBranch(const MicroOp &op)
+{
+	uint16_t next = op.address + op.length;
+	uint16_t target;
+	if (op.opCode == 0x18 || (op.opCode & 0xE7) == 0x20)
+		target = next + (int8_t)op.operands[0];
+	else
+		target = op.operands[0] | (op.operands[1] << 8);
+	this->movRI32(RAX, target);
+	if (op.opCode != 0x18 && op.opCode != 0xC3)
+	{
+		//NZ, Z, NC, C
+		uint8_t condition = (op.opCode >> 3) & 0x3;
+		this->movRI32(RCX, next);
+		this->testRI32(PINNED_F, (condition < 2) ? FLAG_ZERO : FLAG_CARRY);
+		//not taken when the flag does not match the condition, then neither the target nor the extra cycles apply
+		this->movRI32(R10, baseOpcodes[op.opCode].takenCycles - op.cycles);
+		this->movRI32(R11, 0);
+		this->cmovcc((condition & 1) ? COND_Z : COND_NZ, RAX, RCX);
+		this->cmovcc((condition & 1) ? COND_Z : COND_NZ, R10, R11);
+		this->addMemoryR64(this->layout.cycleCountOffset, R10);
+	}
+	this->storeWord(this->layout.programCounterOffset, RAX);
+}
+//spills the pinned registers, runs the op in the interpreter and leaves its result in AL
+void Recompiler::emitFallback(const MicroOp &op, NativeFallback fallback)
+{
+	this->emitSpill();
+	this->movRI64(ARG0, (uint64_t)this->cpu);
+	this->movRI64(ARG1, (uint64_t)&op);
+	this->movRI64(RAX, (uint64_t)fallback);
+	//call rax
+	this->emit8(0xFF);
+	this->emit8(0xD0);
+}
+void Recompiler::emitAddCycles(uint32_t cycles)
+{
+	if (cycles != 0)
+		this->addMemoryI32(this->layout.cycleCountOffset, cycles);
+}
+void Recompiler::emitSpill()
+{
+	for (int i = 0; i < 8; i++)
+	{
+		if (pinned[i] >= 0)
+			this->storeByte(this->layout.registerOffset[i], pinned[i]);
+	}
+	this->storeByte(this->layout.flagsOffset, PINNED_F);
+	this->storeWord(this->layout.stackPointerOffset, PINNED_SP);
+}
+void Recompiler::emitReload()
+{
+	for (int i = 0; i < 8; i++)
+	{
+		if (pinned[i] >= 0)
+			this->loadByte(pinned[i], this->layout.registerOffset[i]);
+	}
+	this->loadByte(PINNED_F, this->layout.flagsOffset);
+	this->loadWord(PINNED_SP, this->layout.stackPointerOffset);
+}
+//pair is the 2 bit register pair field: BC, DE, HL, SP
+void Recompiler::emitReadPair(int dst, int pair)
+{
+	if (pair == 3)
+	{
+		this->movRR32(dst, PINNED_SP);
+		return;
+	}
+	this->movRR32(dst, pinned[pair * 2]);
+	this->shiftRI32(4, dst, 8);
+	this->aluRR32(0x09, dst, pinned[pair * 2 + 1]);
+}
+//clobbers src
+void Recompiler::emitWritePair(int pair, int src)
+{
+	if (pair == 3)
+	{
+		this->movzxR16(PINNED_SP, src);
+		return;
+	}
+	this->movzxR8(pinned[pair * 2 + 1], src);
+	this->shiftRI32(5, src, 8);
+	this->movzxR8(pinned[pair * 2], src);
+}
+//must directly follow the 8 bit op producing the flags. F = (lahf flags & fromLahf) | (F & keep) | set
+void Recompiler::emitFlagsFromLahf(uint8_t fromLahf, uint8_t keep, uint8_t set)
+{
+	//lahf, movzx ecx, ah
+	this->emit8(0x9F);
+	this->emit8(0x0F); this->emit8(0xB6); this->emit8(0xCC);
+	this->movRI64(RDX, (uint64_t)this->lahfToFlags);
+	//movzx eax, byte [rdx + rcx]
+	this->emit8(0x0F); this->emit8(0xB6); this->emit8(0x04); this->emit8(0x0A);
+	if (fromLahf != (FLAG_ZERO | FLAG_HALF_CARRY | FLAG_CARRY))
+		this->aluRI32(4, RAX, fromLahf);
+	this->aluRI32(4, PINNED_F, keep);
+	this->aluRR32(0x09, PINNED_F, RAX);
+	if (set != 0)
+		this->aluRI32(1, PINNED_F, set);
+}
+//F = Z from reg, C from the host carry, N and H clear
+void Recompiler::emitFlagsZeroCarry(int reg)
+{
+	this->setcc(COND_C, RAX);
+	this->testRR8(reg, reg);
+	this->setcc(COND_Z, RCX);
+	this->movzxR8(PINNED_F, RCX);
+	this->shiftRI32(4, PINNED_F, 7);
+	this->movzxR8(RAX, RAX);
+	this->shiftRI32(4, RAX, 4);
+	this->aluRR32(0x09, PINNED_F, RAX);
+}
+//F = C from the host carry, everything else clear
+void Recompiler::emitFlagsCarryOnly()
+{
+	this->setcc(COND_C, RAX);
+	this->movzxR8(PINNED_F, RAX);
+	this->shiftRI32(4, PINNED_F, 4);
+}
+//F = Z from the host zero flag | set
+void Recompiler::emitFlagsZeroOnly(uint8_t set)
+{
+	this->setcc(COND_Z, RAX);
+	this->movzxR8(PINNED_F, RAX);
+	this->shiftRI32(4, PINNED_F, 7);
+	if (set != 0)
+		this->aluRI32(1, PINNED_F, set);
+}
+
+//x86-64 encoding
+void Recompiler::emit8(uint8_t value)
+{
+	*this->code = value;
+	this->code++;
+}
+void Recompiler::emit32(uint32_t value)
+{
+	memcpy(this->code, &value, 4);
+	this->code += 4;
+}
+void Recompiler::emit64(uint64_t value)
+{
+	memcpy(this->code, &value, 8);
+	this->code += 8;
+}
+//byte register operands always get a REX so 4-7 mean SPL/BPL/SIL/DIL rather than AH/CH/DH/BH
+void Recompiler::emitRex(bool wide, int reg, int rm, bool byteRegisters)
+{
+	uint8_t rex = 0x40 | (wide ? 0x08 : 0) | ((reg & 8) ? 0x04 : 0) | ((rm & 8) ? 0x01 : 0);
+	if (rex != 0x40 || byteRegisters)
+		this->emit8(rex);
+}
+void Recompiler::emitModRM(int reg, int rm)
+{
+	this->emit8(0xC0 | ((reg & 7) << 3) | (rm & 7));
+}
+//[rbx + displacement]
+void Recompiler::emitModRMBase(int reg, int32_t displacement)
+{
+	this->emit8(0x80 | ((reg & 7) << 3) | (BASE & 7));
+	this->emit32((uint32_t)displacement);
+}
+void Recompiler::aluRR8(uint8_t opCode, int dst, int src)
+{
+	this->emitRex(false, src, dst, true);
+	this->emit8(opCode);
+	this->emitModRM(src, dst);
+}
+void Recompiler::aluRI8(int digit, int dst, uint8_t imm)
+{
+	this->emitRex(false, 0, dst, true);
+	this->emit8(0x80);
+	this->emitModRM(digit, dst);
+	this->emit8(imm);
+}
+void Recompiler::aluRR32(uint8_t opCode, int dst, int src)
+{
+	this->emitRex(false, src, dst, false);
+	this->emit8(opCode);
+	this->emitModRM(src, dst);
+}
+void Recompiler::aluRI32(int digit, int dst, uint32_t imm)
+{
+	this->emitRex(false, 0, dst, false);
+	this->emit8(0x81);
+	this->emitModRM(digit, dst);
+	this->emit32(imm);
+}
+void Recompiler::movRR32(int dst, int src)
+{
+	this->emitRex(false, src, dst, false);
+	this->emit8(0x89);
+	this->emitModRM(src, dst);
+}
+void Recompiler::movRR64(int dst, int src)
+{
+	this->emitRex(true, src, dst, false);
+	this->emit8(0x89);
+	this->emitModRM(src, dst);
+}
+void Recompiler::movRI32(int dst, uint32_t imm)
+{
+	this->emitRex(false, 0, dst, false);
+	this->emit8(0xB8 + (dst & 7));
+	this->emit32(imm);
+}
+void Recompiler::movRI64(int dst, uint64_t imm)
+{
+	this->emitRex(true, 0, dst, false);
+	this->emit8(0xB8 + (dst & 7));
+	this->emit64(imm);
+}
+void Recompiler::movzxR8(int dst, int src)
+{
+	this->emitRex(false, dst, src, true);
+	this->emit8(0x0F);
+	this->emit8(0xB6);
+	this->emitModRM(dst, src);
+}
+void Recompiler::movzxR16(int dst, int src)
+{
+	this->emitRex(false, dst, src, false);
+	this->emit8(0x0F);
+	this->emit8(0xB7);
+	this->emitModRM(dst, src);
+}
+void Recompiler::loadByte(int dst, int32_t displacement)
+{
+	this->emitRex(false, dst, BASE, false);
+	this->emit8(0x0F);
+	this->emit8(0xB6);
+	this->emitModRMBase(dst, displacement);
+}
+void Recompiler::loadWord(int dst, int32_t displacement)
+{
+	this->emitRex(false, dst, BASE, false);
+	this->emit8(0x0F);
+	this->emit8(0xB7);
+	this->emitModRMBase(dst, displacement);
+}
+void Recompiler::storeByte(int32_t displacement, int src)
+{
+	this->emitRex(false, src, BASE, true);
+	this->emit8(0x88);
+	this->emitModRMBase(src, displacement);
+}
+void Recompiler::storeWord(int32_t displacement, int src)
+{
+	this->emit8(0x66);
+	this->emitRex(false, src, BASE, false);
+	this->emit8(0x89);
+	this->emitModRMBase(src, displacement);
+}
+//64 bit add to [rbx + displacement]
+void Recompiler::addMemoryI32(int32_t displacement, uint32_t imm)
+{
+	this->emitRex(true, 0, BASE, false);
+	this->emit8(0x81);
+	this->emitModRMBase(0, displacement);
+	this->emit32(imm);
+}
+void Recompiler::addMemoryR64(int32_t displacement, int src)
+{
+	this->emitRex(true, src, BASE, false);
+	this->emit8(0x01);
+	this->emitModRMBase(src, displacement);
+}
+//digit: 0 ROL, 1 ROR, 2 RCL, 3 RCR, 4 SHL, 5 SHR, 7 SAR
+void Recompiler::shiftRI32(int digit, int dst, uint8_t count)
+{
+	this->emitRex(false, 0, dst, false);
+	this->emit8(0xC1);
+	this->emitModRM(digit, dst);
+	this->emit8(count);
+}
+void Recompiler::shiftR8(int digit, int dst, uint8_t count)
+{
+	this->emitRex(false, 0, dst, true);
+	if (count == 1)
+	{
+		this->emit8(0xD0);
+		this->emitModRM(digit, dst);
+	}
+	else
+	{
+		this->emit8(0xC0);
+		this->emitModRM(digit, dst);
+		this->emit8(count);
+	}
+}
+void Recompiler::btRI32(int dst, uint8_t bit)
+{
+	this->emitRex(false, 0, dst, false);
+	this->emit8(0x0F);
+	this->emit8(0xBA);
+	this->emitModRM(4, dst);
+	this->emit8(bit);
+}
+void Recompiler::testRR8(int a, int b)
+{
+	this->emitRex(false, b, a, true);
+	this->emit8(0x84);
+	this->emitModRM(b, a);
+}
+void Recompiler::testRI8(int dst, uint8_t imm)
+{
+	this->emitRex(false, 0, dst, true);
+	this->emit8(0xF6);
+	this->emitModRM(0, dst);
+	this->emit8(imm);
+}
+void Recompiler::testRI32(int dst, uint32_t imm)
+{
+	this->emitRex(false, 0, dst, false);
+	this->emit8(0xF7);
+	this->emitModRM(0, dst);
+	this->emit32(imm);
+}
+void Recompiler::setcc(int condition, int dst)
+{
+	this->emitRex(false, 0, dst, true);
+	this->emit8(0x0F);
+	this->emit8(0x90 + condition);
+	this->emitModRM(0, dst);
+}
+void Recompiler::cmovcc(int condition, int dst, int src)
+{
+	this->emitRex(false, dst, src, false);
+	this->emit8(0x0F);
+	this->emit8(0x40 + condition);
+	this->emitModRM(dst, src);
+}
+void Recompiler::notR8(int dst)
+{
+	this->emitRex(false, 0, dst, true);
+	this->emit8(0xF6);
+	this->emitModRM(2, dst);
+}
+void Recompiler::push(int reg)
+{
+	if (reg & 8)
+		this->emit8(0x41);
+	this->emit8(0x50 + (reg & 7));
+}
+void Recompiler::pop(int reg)
+{
+	if (reg & 8)
+		this->emit8(0x41);
+	this->emit8(0x58 + (reg & 7));
+}
+//jz rel32 with the target filled in later by patchForward
+uint8_t* Recompiler::jzForward()
+{
+	this->emit8(0x0F);
+	this->emit8(0x84);
+	this->emit32(0);
+	return this->code;
+}
+void Recompiler::patchForward(uint8_t* jump, uint8_t* target)
+{
+	int32_t offset = (int32_t)(target - jump);
+	memcpy(jump - 4, &offset, 4);
+}
+#endif
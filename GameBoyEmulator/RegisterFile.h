@@ -0,0 +1,39 @@
+#pragma once
+#include <cstdint>
+
+enum CpuState{ RUNNING, INTERRUPT, STOP, HALT, LOCKED };
+//operation the pending flags come from, FLAGS_RESOLVED means F is up to date
+enum FlagOperation{ FLAGS_RESOLVED, FLAGS_ADD, FLAGS_SUB, FLAGS_AND, FLAGS_LOGIC, FLAGS_INC, FLAGS_DEC };
+
+//a 16 bit register pair whose 8 bit halves alias it, so both views are plain loads and stores
+union RegisterPair
+{
+	uint16_t pair;
+	struct
+	{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+		uint8_t high, low;
+#else
+		uint8_t low, high;
+#endif
+	};
+};
+
+//every piece of CPU state an instruction can change, kept in one cache line so a snapshot is a single copy
+struct alignas(64) RegisterFile
+{
+	RegisterPair AF, BC, DE, HL;
+	uint16_t SP, PC;
+	//INTERRUPT asks the run loop to look at IF/IE/IME before the next instruction
+	CpuState cpuState;
+	bool interruptsEnabled;
+	//last flag producing operation, see CPU::resolveFlags
+	FlagOperation flagOperation;
+	uint8_t flagLeft, flagRight, flagResult;
+	bool flagCarry;
+	//IF and IE
+	uint8_t interruptFlags, interruptEnable;
+	//clock cycles executed since power on
+	uint64_t cycles;
+};
+static_assert(sizeof(RegisterFile) == 64, "RegisterFile must fill exactly one cache line");
@@ -0,0 +1,90 @@
+#pragma once
+#include "MappedFile.h"
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+using namespace std;
+
+//Immutable contents of a ROM file. Every Memory in the process that loads the same path gets the same
+//image, it goes away with the last of them.
+class RomImage
+{
+	//Attributes
+private:
+	MappedFile file;
+	//only filled when the file had to be padded, otherwise data points into the mapping
+	vector<uint8_t> padded;
+	const uint8_t* data;
+	size_t size;
+	static mutex registryLock;
+	static unordered_map<string, weak_ptr<const RomImage>> registry;
+	//Methods
+public:
+	RomImage(const char* fileName, size_t bankSize, size_t minimumSize);
+	RomImage(const RomImage &) = delete;
+	RomImage &operator=(const RomImage &) = delete;
+	static shared_ptr<const RomImage> load(const char* fileName, size_t bankSize, size_t minimumSize);
+	const uint8_t* getData() const;
+	size_t getSize() const;
+	size_t getFileSize() const;
+	bool isLoaded() const;
+};
+
+mutex RomImage::registryLock;
+unordered_map<string, weak_ptr<const RomImage>> RomImage::registry;
+
+//the image is a whole number of bankSize banks and at least minimumSize bytes, anything the file does
+//not fill reads as 0xFF
+RomImage::RomImage(const char* fileName, size_t bankSize, size_t minimumSize) : file(fileName)
+{
+	size_t fileSize = this->file.getSize();
+	this->size = fileSize > minimumSize ? (fileSize + bankSize - 1) / bankSize * bankSize : minimumSize;
+	if (this->size == fileSize)
+	{
+		this->data = this->file.getData();
+		return;
+	}
+	this->padded.assign(this->size, 0xFF);
+	if (fileSize > 0)
+		memcpy(this->padded.data(), this->file.getData(), fileSize);
+	this->data = this->padded.data();
+}
+//the image already loaded from this path if any instance still holds it
+shared_ptr<const RomImage> RomImage::load(const char* fileName, size_t bankSize, size_t minimumSize)
+{
+	lock_guard<mutex> lock(registryLock);
+	weak_ptr<const RomImage> &entry = registry[fileName];
+	shared_ptr<const RomImage> image = entry.lock();
+	if (image == nullptr)
+	{
+		image = make_shared<const RomImage>(fileName, bankSize, minimumSize);
+		//a file that failed to load is tried again by the next instance
+		if (image->isLoaded())
+			entry = image;
+		else
+			registry.erase(fileName);
+	}
+	return image;
+}
+const uint8_t* RomImage::getData() const
+{
+	return this->data;
+}
+size_t RomImage::getSize() const
+{
+	return this->size;
+}
+//bytes actually in the file
+size_t RomImage::getFileSize() const
+{
+	return this->file.getSize();
+}
+//false when the file could not be opened or mapped, the image is then all 0xFF
+bool RomImage::isLoaded() const
+{
+	return this->file.getData() != nullptr;
+}
@@ -0,0 +1,180 @@
+#pragma once
+#include "Memory.h"
+#include "Scheduler.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+using namespace std;
+
+//Battery backed cartridge RAM kept in a .sav file. The file is read into external RAM at startup. Every
+//COLLECT_CYCLES the pages the game wrote are copied out and a background thread writes just those pages,
+//adjacent ones in a single write, at most once every MIN_WRITE_INTERVAL however often the game saves.
+class SaveFile
+{
+	//Attributes
+private:
+	//about a quarter of a second
+	static const uint64_t COLLECT_CYCLES = 1 << 20;
+	static const int PAGE_SIZE = 0x100;
+	static const chrono::milliseconds MIN_WRITE_INTERVAL;
+	Memory* memory;
+	Scheduler* scheduler;
+	fstream file;
+	int pageCount = 0;
+	//copies of dirty pages waiting for the writer, a page written twice before then is saved once
+	vector<uint8_t> staged;
+	vector<uint8_t> stagedDirty;
+	bool pending = false;
+	bool running = false;
+	mutex stageLock;
+	condition_variable wake;
+	thread writer;
+	//Methods
+public:
+	SaveFile(Memory* memPtr, Scheduler* schedulerPtr, const char* fileName);
+	~SaveFile();
+	SaveFile(const SaveFile &) = delete;
+	SaveFile &operator=(const SaveFile &) = delete;
+private:
+	static void collect(void* component, uint64_t cycle);
+	void stage();
+	void drain();
+	void writePages(const vector<uint8_t> &pages, const vector<uint8_t> &dirty);
+};
+
+const chrono::milliseconds SaveFile::MIN_WRITE_INTERVAL(1000);
+
+//does nothing for cartridges without a battery
+SaveFile::SaveFile(Memory* memPtr, Scheduler* schedulerPtr, const char* fileName)
+{
+	this->memory = memPtr;
+	this->scheduler = schedulerPtr;
+	int size = memPtr->getExternalRamSize();
+	if (size == 0 || !memPtr->hasBattery())
+		return;
+	this->pageCount = size / PAGE_SIZE;
+	this->staged.assign(size, 0);
+	this->stagedDirty.assign(this->pageCount, 0);
+
+	this->file.open(fileName, ios::in | ios::out | ios::binary);
+	streamoff fileSize = 0;
+	if (this->file.is_open())
+	{
+		this->file.seekg(0, ios::end);
+		fileSize = this->file.tellg();
+		this->file.seekg(0);
+		this->file.read(reinterpret_cast<char*>(memPtr->getExternalRam()), min<streamoff>(fileSize, size));
+		this->file.clear();
+	}
+	//pages are written in place, so the file has to cover the whole RAM first
+	if (fileSize != size)
+	{
+		this->file.close();
+		this->file.open(fileName, ios::in | ios::out | ios::binary | ios::trunc);
+		this->file.write(reinterpret_cast<const char*>(memPtr->getExternalRam()), size);
+		this->file.flush();
+	}
+	if (!this->file.is_open())
+		return;
+
+	this->running = true;
+	this->writer = thread(&SaveFile::drain, this);
+	schedulerPtr->setHandler(EVENT_SAVE, this, &SaveFile::collect);
+	schedulerPtr->schedule(EVENT_SAVE, schedulerPtr->getCurrentCycle() + COLLECT_CYCLES);
+}
+//whatever the writer has not got to yet is written before returning
+SaveFile::~SaveFile()
+{
+	if (!this->running)
+		return;
+	this->scheduler->cancel(EVENT_SAVE);
+	{
+		lock_guard<mutex> lock(this->stageLock);
+		this->running = false;
+	}
+	this->wake.notify_one();
+	this->writer.join();
+	this->stage();
+	this->writePages(this->staged, this->stagedDirty);
+}
+void SaveFile::collect(void* component, uint64_t cycle)
+{
+	SaveFile* save = static_cast<SaveFile*>(component);
+	save->stage();
+	save->scheduler->schedule(EVENT_SAVE, cycle + COLLECT_CYCLES);
+}
+//copies dirty pages out of external RAM. If the writer is busy with the staging area the pages stay
+//dirty for the next collection, the emulation thread never waits on the disk
+void SaveFile::stage()
+{
+	unique_lock<mutex> lock(this->stageLock, try_to_lock);
+	if (!lock.owns_lock())
+		return;
+	const uint8_t* ram = this->memory->getExternalRam();
+	bool found = false;
+	for (int page = 0; page < this->pageCount; page++)
+	{
+		if (!this->memory->takeDirtyRamPage(page))
+			continue;
+		memcpy(&this->staged[page * PAGE_SIZE], ram + page * PAGE_SIZE, PAGE_SIZE);
+		this->stagedDirty[page] = 1;
+		found = true;
+	}
+	if (!found)
+		return;
+	this->pending = true;
+	lock.unlock();
+	this->wake.notify_one();
+}
+void SaveFile::drain()
+{
+	vector<uint8_t> pages(this->staged.size());
+	vector<uint8_t> dirty(this->pageCount);
+	unique_lock<mutex> lock(this->stageLock);
+	chrono::steady_clock::time_point lastWrite = chrono::steady_clock::now() - MIN_WRITE_INTERVAL;
+	while (true)
+	{
+		this->wake.wait(lock, [this] { return this->pending || !this->running; });
+		if (!this->running)
+			return;
+		//let saves that arrive in the meantime pile onto this write
+		if (this->wake.wait_until(lock, lastWrite + MIN_WRITE_INTERVAL, [this] { return !this->running; }))
+			return;
+		for (int page = 0; page < this->pageCount; page++)
+		{
+			dirty[page] = this->stagedDirty[page];
+			if (dirty[page])
+				memcpy(&pages[page * PAGE_SIZE], &this->staged[page * PAGE_SIZE], PAGE_SIZE);
+		}
+		fill(this->stagedDirty.begin(), this->stagedDirty.end(), 0);
+		this->pending = false;
+		lock.unlock();
+		this->writePages(pages, dirty);
+		lastWrite = chrono::steady_clock::now();
+		lock.lock();
+	}
+}
+//one write per run of adjacent dirty pages, then hands the data to the OS so it survives a crash of the emulator
+void SaveFile::writePages(const vector<uint8_t> &pages, const vector<uint8_t> &dirty)
+{
+	bool wrote = false;
+	for (int start = 0; start < this->pageCount; start++)
+	{
+		if (!dirty[start])
+			continue;
+		int end = start;
+		while (end + 1 < this->pageCount && dirty[end + 1])
+			end++;
+		this->file.seekp((streamoff)start * PAGE_SIZE);
+		this->file.write(reinterpret_cast<const char*>(&pages[start * PAGE_SIZE]), (end - start + 1) * PAGE_SIZE);
+		wrote = true;
+		start = end;
+	}
+	if (wrote)
+		this->file.flush();
+}
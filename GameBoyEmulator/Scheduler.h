@@ -0,0 +1,148 @@
+#pragma once
+#include "MachineState.h"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+using namespace std;
+
+//cycle is the one the event was scheduled for, the clock can be a few cycles past it
+typedef void (*EventHandler)(void* component, uint64_t cycle);
+
+struct ScheduledEvent
+{
+	uint64_t cycle;
+	EventType type;
+	//rescheduling or cancelling bumps the type's generation, older entries are skipped
+	uint32_t generation;
+};
+
+//Master scheduler: components register the absolute clock cycle of their next event and the CPU runs
+//uninterrupted until the earliest one, instead of every component being stepped along with it.
+class Scheduler
+{
+	//Attributes
+public:
+	static const uint64_t NEVER = UINT64_MAX;
+private:
+	//stale entries are purged once the heap grows past this
+	static const size_t MAX_QUEUE = 64;
+	const uint64_t* clock;
+	//min-heap on cycle
+	vector<ScheduledEvent> queue;
+	void* components[EVENT_TYPE_COUNT] = {};
+	EventHandler handlers[EVENT_TYPE_COUNT] = {};
+	uint32_t generation[EVENT_TYPE_COUNT] = {};
+	SchedulerState* state;
+	//Methods
+public:
+	Scheduler(const uint64_t* clockPtr, SchedulerState* statePtr);
+	void setHandler(EventType type, void* component, EventHandler handler);
+	uint64_t getCurrentCycle();
+	void schedule(EventType type, uint64_t cycle);
+	void cancel(EventType type);
+	uint64_t getDeadline(EventType type);
+	uint64_t nextEventCycle();
+	void dispatch();
+	void reload();
+private:
+	static bool laterThan(const ScheduledEvent &a, const ScheduledEvent &b);
+	bool isStale(const ScheduledEvent &event);
+	void dropStale();
+};
+
+Scheduler::Scheduler(const uint64_t* clockPtr, SchedulerState* statePtr)
+{
+	this->clock = clockPtr;
+	this->state = statePtr;
+	for (int i = 0; i < EVENT_TYPE_COUNT; i++)
+	{
+		this->state->deadline[i] = NEVER;
+	}
+	this->queue.reserve(MAX_QUEUE + 1);
+}
+void Scheduler::setHandler(EventType type, void* component, EventHandler handler)
+{
+	this->components[type] = component;
+	this->handlers[type] = handler;
+}
+uint64_t Scheduler::getCurrentCycle()
+{
+	return *this->clock;
+}
+//replaces the type's pending event, if any
+void Scheduler::schedule(EventType type, uint64_t cycle)
+{
+	this->generation[type]++;
+	this->state->deadline[type] = cycle;
+	if (this->queue.size() >= MAX_QUEUE)
+	{
+		this->queue.erase(remove_if(this->queue.begin(), this->queue.end(),
+			[this](const ScheduledEvent &event) { return this->isStale(event); }), this->queue.end());
+		make_heap(this->queue.begin(), this->queue.end(), &Scheduler::laterThan);
+	}
+	this->queue.push_back({ cycle, type, this->generation[type] });
+	push_heap(this->queue.begin(), this->queue.end(), &Scheduler::laterThan);
+}
+void Scheduler::cancel(EventType type)
+{
+	this->generation[type]++;
+	this->state->deadline[type] = NEVER;
+}
+//NEVER when the type has nothing pending
+uint64_t Scheduler::getDeadline(EventType type)
+{
+	return this->state->deadline[type];
+}
+uint64_t Scheduler::nextEventCycle()
+{
+	this->dropStale();
+	return this->queue.empty() ? NEVER : this->queue.front().cycle;
+}
+//runs every event that is due at the current cycle, in cycle order
+void Scheduler::dispatch()
+{
+	uint64_t now = *this->clock;
+	while (true)
+	{
+		this->dropStale();
+		if (this->queue.empty() || this->queue.front().cycle > now)
+			return;
+		ScheduledEvent event = this->queue.front();
+		pop_heap(this->queue.begin(), this->queue.end(), &Scheduler::laterThan);
+		this->queue.pop_back();
+		this->state->deadline[event.type] = NEVER;
+		//the handler is free to schedule its next event
+		this->handlers[event.type](this->components[event.type], event.cycle);
+	}
+}
+//rebuilds the queue from the deadlines after a snapshot was restored, events of types nothing here
+//handles are dropped
+void Scheduler::reload()
+{
+	this->queue.clear();
+	for (int i = 0; i < EVENT_TYPE_COUNT; i++)
+	{
+		this->generation[i]++;
+		if (this->handlers[i] == nullptr)
+			this->state->deadline[i] = NEVER;
+		if (this->state->deadline[i] != NEVER)
+			this->queue.push_back({ this->state->deadline[i], (EventType)i, this->generation[i] });
+	}
+	make_heap(this->queue.begin(), this->queue.end(), &Scheduler::laterThan);
+}
+bool Scheduler::laterThan(const ScheduledEvent &a, const ScheduledEvent &b)
+{
+	return a.cycle > b.cycle;
+}
+bool Scheduler::isStale(const ScheduledEvent &event)
+{
+	return event.generation != this->generation[event.type];
+}
+void Scheduler::dropStale()
+{
+	while (!this->queue.empty() && this->isStale(this->queue.front()))
+	{
+		pop_heap(this->queue.begin(), this->queue.end(), &Scheduler::laterThan);
+		this->queue.pop_back();
+	}
+}
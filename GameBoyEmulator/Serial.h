@@ -0,0 +1,71 @@
+#pragma once
+#include "Memory.h"
+#include "Scheduler.h"
+#include <cstdint>
+#include <ostream>
+using namespace std;
+
+//SB and SC (FF01/FF02). No link cable is attached, so a transfer shifts in 0xFF and the
+//serial interrupt fires once the 8 bits would have gone out.
+class Serial
+{
+	//Attributes
+private:
+	//8 bits at 8192 Hz
+	static const uint64_t TRANSFER_CYCLES = 8 * 512;
+	Memory* memory;
+	Scheduler* scheduler;
+	//bytes the game sends are copied here when set, test ROMs report their results this way
+	ostream* output;
+	//SB and SC, kept in the machine state arena
+	SerialState* state;
+	//Methods
+public:
+	Serial(Memory* memPtr, Scheduler* schedulerPtr, ostream* outputStream = nullptr);
+private:
+	static uint8_t readRegister(void* component, uint16_t address);
+	static void writeRegister(void* component, uint16_t address, uint8_t value);
+	static void transferComplete(void* component, uint64_t cycle);
+};
+
+Serial::Serial(Memory* memPtr, Scheduler* schedulerPtr, ostream* outputStream)
+{
+	this->memory = memPtr;
+	this->scheduler = schedulerPtr;
+	this->output = outputStream;
+	this->state = &memPtr->getState()->serial;
+	memPtr->mapIo(0xFF01, this, &Serial::readRegister, &Serial::writeRegister);
+	memPtr->mapIo(0xFF02, this, &Serial::readRegister, &Serial::writeRegister);
+	schedulerPtr->setHandler(EVENT_SERIAL, this, &Serial::transferComplete);
+}
+uint8_t Serial::readRegister(void* component, uint16_t address)
+{
+	Serial* serial = static_cast<Serial*>(component);
+	return address == 0xFF01 ? serial->state->sb : (serial->state->sc | 0x7E);
+}
+void Serial::writeRegister(void* component, uint16_t address, uint8_t value)
+{
+	Serial* serial = static_cast<Serial*>(component);
+	if (address == 0xFF01)
+	{
+		serial->state->sb = value;
+		return;
+	}
+	serial->state->sc = value & 0x81;
+	//only transfers on the internal clock ever finish without a partner
+	if ((serial->state->sc & 0x81) == 0x81)
+	{
+		if (serial->output != nullptr)
+			serial->output->put((char)serial->state->sb);
+		serial->scheduler->schedule(EVENT_SERIAL, serial->scheduler->getCurrentCycle() + TRANSFER_CYCLES);
+	}
+	else
+		serial->scheduler->cancel(EVENT_SERIAL);
+}
+void Serial::transferComplete(void* component, uint64_t)
+{
+	Serial* serial = static_cast<Serial*>(component);
+	serial->state->sb = 0xFF;
+	serial->state->sc &= 0x7F;
+	serial->memory->requestInterrupt(INTERRUPT_SERIAL);
+}
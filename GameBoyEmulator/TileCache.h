@@ -0,0 +1,53 @@
+#pragma once
+#include "PixelKernels.h"
+#include <cstdint>
+#include <cstring>
+using namespace std;
+
+//The 384 tiles of VRAM tile data (8000-97FF) decoded to one colour index (0-3) per byte, so the renderer
+//copies 8 byte rows instead of pulling pixels out of the 2bpp planes. A tile is decoded again on first
+//use after a write to any of its 16 bytes.
+class TileCache
+{
+	//Attributes
+public:
+	static const int TILE_COUNT = 384;
+private:
+	//8000 onwards
+	const uint8_t* vram;
+	uint8_t pixels[TILE_COUNT][64];
+	bool stale[TILE_COUNT];
+	//Methods
+public:
+	TileCache(const uint8_t* vramPtr);
+	const uint8_t* getRow(int tile, int row);
+	void invalidate(uint16_t start, uint16_t end);
+private:
+	void decode(int tile);
+};
+
+TileCache::TileCache(const uint8_t* vramPtr)
+{
+	this->vram = vramPtr;
+	memset(this->stale, true, sizeof(this->stale));
+}
+//the 8 colour indices of row 0-7 of the tile at 8000 + tile * 16, left pixel first
+const uint8_t* TileCache::getRow(int tile, int row)
+{
+	if (this->stale[tile])
+		this->decode(tile);
+	return &this->pixels[tile][row * 8];
+}
+//start-end were written, addresses past the tile data are ignored
+void TileCache::invalidate(uint16_t start, uint16_t end)
+{
+	for (int tile = (start - 0x8000) >> 4; tile <= (end - 0x8000) >> 4 && tile < TILE_COUNT; tile++)
+	{
+		this->stale[tile] = true;
+	}
+}
+void TileCache::decode(int tile)
+{
+	PixelKernels::decodeTile(&this->vram[tile * 16], this->pixels[tile]);
+	this->stale[tile] = false;
+}
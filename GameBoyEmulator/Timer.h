@@ -0,0 +1,135 @@
+#pragma once
+#include "Memory.h"
+#include "Scheduler.h"
+#include <cstdint>
+
+//DIV, TIMA, TMA and TAC (FF04-FF07). Nothing is ticked: DIV and TIMA are worked out from the clock
+//when they are read and the only scheduled event is the next TIMA overflow.
+class Timer
+{
+	//Attributes
+private:
+	//clock cycles per TIMA increment for each TAC clock select
+	static const uint32_t tickPeriods[4];
+	Memory* memory;
+	Scheduler* scheduler;
+	//registers and counters, kept in the machine state arena
+	TimerState* state;
+	//Methods
+public:
+	Timer(Memory* memPtr, Scheduler* schedulerPtr);
+private:
+	static uint8_t readRegister(void* component, uint16_t address);
+	static void writeRegister(void* component, uint16_t address, uint8_t value);
+	static uint64_t nextChange(void* component, uint16_t address);
+	static void overflow(void* component, uint64_t cycle);
+	bool isRunning();
+	uint32_t getPeriod();
+	uint64_t currentTick();
+	uint8_t getTima();
+	void syncTima();
+	void scheduleOverflow();
+};
+
+const uint32_t Timer::tickPeriods[4] = { 1024, 16, 64, 256 };
+
+Timer::Timer(Memory* memPtr, Scheduler* schedulerPtr)
+{
+	this->memory = memPtr;
+	this->scheduler = schedulerPtr;
+	this->state = &memPtr->getState()->timer;
+	this->state->dividerStart = schedulerPtr->getCurrentCycle();
+	for (uint16_t address = 0xFF04; address <= 0xFF07; address++)
+	{
+		memPtr->mapIo(address, this, &Timer::readRegister, &Timer::writeRegister, &Timer::nextChange);
+	}
+	schedulerPtr->setHandler(EVENT_TIMER, this, &Timer::overflow);
+}
+uint8_t Timer::readRegister(void* component, uint16_t address)
+{
+	Timer* timer = static_cast<Timer*>(component);
+	switch (address)
+	{
+	case 0xFF04: return (uint8_t)((timer->scheduler->getCurrentCycle() - timer->state->dividerStart) >> 8);
+	case 0xFF05: return timer->getTima();
+	case 0xFF06: return timer->state->tma;
+	default: return timer->state->tac | 0xF8;
+	}
+}
+void Timer::writeRegister(void* component, uint16_t address, uint8_t value)
+{
+	Timer* timer = static_cast<Timer*>(component);
+	timer->syncTima();
+	switch (address)
+	{
+	case 0xFF04:
+		//any write clears the divider, TIMA restarts counting from here
+		timer->state->dividerStart = timer->scheduler->getCurrentCycle();
+		timer->state->timaTick = 0;
+		break;
+	case 0xFF05:
+		timer->state->timaValue = value;
+		break;
+	case 0xFF06:
+		timer->state->tma = value;
+		return;
+	default:
+		timer->state->tac = value & 0x07;
+		timer->state->timaTick = timer->currentTick();
+		break;
+	}
+	timer->scheduleOverflow();
+}
+//DIV and a running TIMA count up on their own, TMA and TAC only change when written
+uint64_t Timer::nextChange(void* component, uint16_t address)
+{
+	Timer* timer = static_cast<Timer*>(component);
+	if (address == 0xFF04)
+		return timer->state->dividerStart + (((timer->scheduler->getCurrentCycle() - timer->state->dividerStart) >> 8) + 1) * 256;
+	if (address == 0xFF05 && timer->isRunning())
+		return timer->state->dividerStart + (timer->currentTick() + 1) * timer->getPeriod();
+	return UINT64_MAX;
+}
+//TIMA wrapped: reload it from TMA and raise the timer interrupt
+void Timer::overflow(void* component, uint64_t cycle)
+{
+	Timer* timer = static_cast<Timer*>(component);
+	timer->state->timaValue = timer->state->tma;
+	timer->state->timaTick = (cycle - timer->state->dividerStart) / timer->getPeriod();
+	timer->memory->requestInterrupt(INTERRUPT_TIMER);
+	timer->scheduleOverflow();
+}
+bool Timer::isRunning()
+{
+	return (this->state->tac & 0x04) != 0;
+}
+uint32_t Timer::getPeriod()
+{
+	return tickPeriods[this->state->tac & 0x03];
+}
+uint64_t Timer::currentTick()
+{
+	return (this->scheduler->getCurrentCycle() - this->state->dividerStart) / this->getPeriod();
+}
+//the overflow event always fires before TIMA could pass 0xFF
+uint8_t Timer::getTima()
+{
+	if (!this->isRunning())
+		return this->state->timaValue;
+	return (uint8_t)(this->state->timaValue + (this->currentTick() - this->state->timaTick));
+}
+void Timer::syncTima()
+{
+	this->state->timaValue = this->getTima();
+	this->state->timaTick = this->currentTick();
+}
+void Timer::scheduleOverflow()
+{
+	if (!this->isRunning())
+	{
+		this->scheduler->cancel(EVENT_TIMER);
+		return;
+	}
+	uint64_t overflowTick = this->state->timaTick + (256 - this->state->timaValue);
+	this->scheduler->schedule(EVENT_TIMER, this->state->dividerStart + overflowTick * this->getPeriod());
+}
@@ -0,0 +1,132 @@
+#pragma once
+#include "RegisterFile.h"
+#include "Disassembler.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <thread>
+using namespace std;
+
+//one executed instruction, registers are the values before it ran
+struct TraceRecord
+{
+	uint16_t address;
+	uint8_t opCode;
+	//operand bytes, the CB opcode for prefixed instructions
+	uint8_t operands[2];
+	uint8_t cycles;
+	uint16_t AF, BC, DE, HL, SP;
+};
+static_assert(sizeof(TraceRecord) == 16, "trace records are written to disk as is");
+
+//Trace policy that does nothing, every call into it is removed at compile time
+class NullTrace
+{
+public:
+	static const bool ENABLED = false;
+	void record(uint16_t, uint8_t, uint8_t, uint8_t, uint8_t, const RegisterFile &) {}
+};
+
+//Trace policy that copies records into a ring buffer, a background thread appends them to a file.
+//The CPU only waits when the writer falls a whole buffer behind.
+class RingBufferTrace
+{
+public:
+	static const bool ENABLED = true;
+	static const uint32_t BUFFER_RECORDS = 1 << 16;
+private:
+	TraceRecord* buffer;
+	//records written by the CPU and records flushed by the writer, both only ever grow
+	atomic<uint64_t> head;
+	atomic<uint64_t> tail;
+	atomic<bool> running;
+	ofstream file;
+	thread writer;
+public:
+	RingBufferTrace(const char* fileName = "trace.bin");
+	~RingBufferTrace();
+	RingBufferTrace(const RingBufferTrace &) = delete;
+	RingBufferTrace &operator=(const RingBufferTrace &) = delete;
+	void record(uint16_t address, uint8_t opCode, uint8_t operand0, uint8_t operand1, uint8_t cycles, const RegisterFile &registers);
+	static void print(const char* fileName, ostream &out);
+private:
+	void drain();
+	bool flush();
+};
+
+RingBufferTrace::RingBufferTrace(const char* fileName) : head(0), tail(0), running(true)
+{
+	this->buffer = new TraceRecord[BUFFER_RECORDS];
+	this->file.open(fileName, ios::out | ios::binary | ios::trunc);
+	this->writer = thread(&RingBufferTrace::drain, this);
+}
+RingBufferTrace::~RingBufferTrace()
+{
+	this->running.store(false, memory_order_release);
+	this->writer.join();
+	//pick up whatever was recorded after the writer last looked
+	while (this->flush());
+	this->file.close();
+	delete[] this->buffer;
+}
+void RingBufferTrace::record(uint16_t address, uint8_t opCode, uint8_t operand0, uint8_t operand1, uint8_t cycles, const RegisterFile &registers)
+{
+	uint64_t position = this->head.load(memory_order_relaxed);
+	while (position - this->tail.load(memory_order_acquire) == BUFFER_RECORDS)
+		this_thread::yield();
+	TraceRecord &entry = this->buffer[position & (BUFFER_RECORDS - 1)];
+	entry.address = address;
+	entry.opCode = opCode;
+	entry.operands[0] = operand0;
+	entry.operands[1] = operand1;
+	entry.cycles = cycles;
+	entry.AF = registers.AF.pair;
+	entry.BC = registers.BC.pair;
+	entry.DE = registers.DE.pair;
+	entry.HL = registers.HL.pair;
+	entry.SP = registers.SP;
+	this->head.store(position + 1, memory_order_release);
+}
+void RingBufferTrace::drain()
+{
+	while (this->running.load(memory_order_acquire))
+	{
+		if (!this->flush())
+			this_thread::sleep_for(chrono::milliseconds(1));
+	}
+}
+//writes out the oldest contiguous run of records, false when there was nothing to write
+bool RingBufferTrace::flush()
+{
+	uint64_t start = this->tail.load(memory_order_relaxed);
+	uint64_t end = this->head.load(memory_order_acquire);
+	if (start == end)
+		return false;
+	uint64_t index = start & (BUFFER_RECORDS - 1);
+	uint64_t count = end - start;
+	if (index + count > BUFFER_RECORDS)
+		count = BUFFER_RECORDS - index;
+	this->file.write(reinterpret_cast<const char*>(&this->buffer[index]), count * sizeof(TraceRecord));
+	this->tail.store(start + count, memory_order_release);
+	return true;
+}
+//writes a trace file back out as text, one disassembled instruction per line
+void RingBufferTrace::print(const char* fileName, ostream &out)
+{
+	ifstream file(fileName, ios::in | ios::binary);
+	TraceRecord entry;
+	char text[32];
+	out << hex << uppercase << setfill('0');
+	while (file.read(reinterpret_cast<char*>(&entry), sizeof(TraceRecord)))
+	{
+		uint8_t bytes[3] = { entry.opCode, entry.operands[0], entry.operands[1] };
+		Disassembler::format(bytes, entry.address, text, sizeof(text));
+		out << setw(4) << entry.address << "  " << left << setfill(' ') << setw(20) << text << right << setfill('0')
+			<< " AF=" << setw(4) << entry.AF << " BC=" << setw(4) << entry.BC << " DE=" << setw(4) << entry.DE
+			<< " HL=" << setw(4) << entry.HL << " SP=" << setw(4) << entry.SP << " " << dec << (int)entry.cycles << hex << "\n";
+	}
+	out << dec << nouppercase << setfill(' ');
+}